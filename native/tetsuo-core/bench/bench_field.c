@@ -3,8 +3,8 @@
  *
  * Measures throughput of core operations:
  * - Montgomery multiplication
- * - Field inversion (Fermat's little theorem)
- * - Batch inversion (Montgomery's trick)
+ * - Field inversion: safegcd (constant and variable time) vs Fermat
+ * - Batch multiplication and inversion (Montgomery's trick), IFMA lanes
  * - Multi-scalar multiplication (Pippenger)
  */
 
@@ -129,27 +129,52 @@ static void bench_add(bench_result_t *r) {
     r->iters = BENCH_ITERS;
 }
 
-static void bench_inv(bench_result_t *r) {
+/* a^(p-2): the exponentiation field_inv used before safegcd */
+static void field_inv_fermat(field_t *r, const field_t *a) {
+    static const uint64_t p_minus_2[4] = {
+        0x3C208C16D87CFD45ULL, 0x97816A916871CA8DULL,
+        0xB85045B68181585DULL, 0x30644E72E131A029ULL
+    };
+    field_pow(r, a, p_minus_2, 4);
+}
+
+static void bench_inv_fn(bench_result_t *r, const char *name,
+                         void (*inv)(field_t *, const field_t *)) {
     field_t a, c;
     random_field(&a);
 
     int iters = BENCH_ITERS / 100;  /* Inversion is much slower */
 
     for (int i = 0; i < WARMUP_ITERS / 100; i++) {
-        field_inv(&c, &a);
+        inv(&c, &a);
+        a.limbs[0] ^= c.limbs[0] & 0xff;
     }
 
     uint64_t start = get_ns();
     for (int i = 0; i < iters; i++) {
-        field_inv(&c, &a);
+        /* Feed the result back so vartime runs see varying inputs */
+        inv(&c, &a);
+        a.limbs[0] ^= c.limbs[0] & 0xff;
     }
     uint64_t end = get_ns();
 
-    r->name = "field_inv";
+    r->name = name;
     r->total_ns = end - start;
     r->iters = iters;
 }
 
+static void bench_inv(bench_result_t *r) {
+    bench_inv_fn(r, "field_inv (safegcd)", field_inv);
+}
+
+static void bench_inv_vartime(bench_result_t *r) {
+    bench_inv_fn(r, "field_inv_vartime", field_inv_vartime);
+}
+
+static void bench_inv_fermat(bench_result_t *r) {
+    bench_inv_fn(r, "field_inv (Fermat)", field_inv_fermat);
+}
+
 static void bench_batch_inv(bench_result_t *r) {
     field_t inputs[BATCH_SIZE];
     field_t outputs[BATCH_SIZE];
@@ -202,6 +227,35 @@ static void bench_batch_mul(bench_result_t *r) {
     r->iters = batches * BATCH_SIZE;
 }
 
+static void bench_batch_mul_soa52(bench_result_t *r) {
+    field_t a[BATCH_SIZE];
+    field_t b[BATCH_SIZE];
+    static uint64_t sa[5 * BATCH_SIZE], sb[5 * BATCH_SIZE], sc[5 * BATCH_SIZE];
+
+    for (int i = 0; i < BATCH_SIZE; i++) {
+        random_field(&a[i]);
+        random_field(&b[i]);
+    }
+    field_to_soa52(sa, a, BATCH_SIZE);
+    field_to_soa52(sb, b, BATCH_SIZE);
+
+    int batches = BENCH_ITERS / BATCH_SIZE;
+
+    for (int i = 0; i < WARMUP_ITERS / BATCH_SIZE; i++) {
+        field_batch_mul_soa52(sc, sa, sb, BATCH_SIZE);
+    }
+
+    uint64_t start = get_ns();
+    for (int i = 0; i < batches; i++) {
+        field_batch_mul_soa52(sc, sa, sb, BATCH_SIZE);
+    }
+    uint64_t end = get_ns();
+
+    r->name = "batch_mul_soa52 (256)";
+    r->total_ns = end - start;
+    r->iters = batches * BATCH_SIZE;
+}
+
 static void bench_arena(bench_result_t *r) {
     arena_t *arena = arena_create(1024 * 1024);
 
@@ -246,16 +300,22 @@ int main(void) {
     printf("Iterations: %d (warmup: %d)\n", BENCH_ITERS, WARMUP_ITERS);
     printf("Batch size: %d\n\n", BATCH_SIZE);
 
-    bench_result_t results[8];
-    int n = 0;
+    bench_result_t results[10];
+    int n = 0, inv_idx, fermat_idx, batch_inv_idx;
 
     printf("Running benchmarks...\n\n");
 
     bench_add(&results[n++]);
     bench_mul(&results[n++]);
     bench_sqr(&results[n++]);
+    inv_idx = n;
     bench_inv(&results[n++]);
+    bench_inv_vartime(&results[n++]);
+    fermat_idx = n;
+    bench_inv_fermat(&results[n++]);
     bench_batch_mul(&results[n++]);
+    bench_batch_mul_soa52(&results[n++]);
+    batch_inv_idx = n;
     bench_batch_inv(&results[n++]);
     bench_arena(&results[n++]);
 
@@ -266,10 +326,14 @@ int main(void) {
     }
     printf("─────────────────────────────────────────────────────\n");
 
-    /* Compute batch speedup */
-    double inv_ns = (double)results[3].total_ns / results[3].iters;
-    double batch_inv_ns = (double)results[5].total_ns / results[5].iters;
-    printf("\nBatch inversion speedup: %.1fx\n", inv_ns / batch_inv_ns);
+    /* Compute speedups */
+    double inv_ns = (double)results[inv_idx].total_ns / results[inv_idx].iters;
+    double vt_ns = (double)results[inv_idx + 1].total_ns / results[inv_idx + 1].iters;
+    double fermat_ns = (double)results[fermat_idx].total_ns / results[fermat_idx].iters;
+    double batch_inv_ns = (double)results[batch_inv_idx].total_ns / results[batch_inv_idx].iters;
+    printf("\nsafegcd vs Fermat: %.1fx (vartime %.1fx)\n",
+           fermat_ns / inv_ns, fermat_ns / vt_ns);
+    printf("Batch inversion speedup: %.1fx\n", inv_ns / batch_inv_ns);
 
     printf("\n");
     return 0;
@@ -6,6 +6,9 @@
 #include "verify.h"
 #include "arena.h"
 #include "field.h"
+#include "field_ifma.h"
+#include "cpu.h"
+#include "threadpool.h"
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
@@ -17,6 +20,9 @@
 #include <sys/time.h>
 #endif
 
+/* Upper bound on tetsuo_config_t.num_threads */
+#define TETSUO_MAX_THREADS 256
+
 /* Internal context structure */
 struct tetsuo_ctx {
     arena_t *arena;
@@ -99,6 +105,16 @@ tetsuo_ctx_t *tetsuo_ctx_create(const tetsuo_config_t *config) {
         if (config->vk_data && config->vk_len > 0) {
             verify_ctx_load_vk(ctx->verify, config->vk_data, config->vk_len);
         }
+
+        ctx->verify->batch_coeffs = config->batch_coeffs == TETSUO_BATCH_COEFFS_TRANSCRIPT
+                                        ? BATCH_COEFFS_TRANSCRIPT : BATCH_COEFFS_RANDOM;
+
+        if (config->num_threads > 1) {
+            uint32_t n = config->num_threads;
+            if (n > TETSUO_MAX_THREADS) n = TETSUO_MAX_THREADS;
+            /* NULL on failure: batches then run on the calling thread */
+            ctx->verify->pool = threadpool_create(n);
+        }
     }
 
     return ctx;
@@ -106,6 +122,7 @@ tetsuo_ctx_t *tetsuo_ctx_create(const tetsuo_config_t *config) {
 
 void tetsuo_ctx_destroy(tetsuo_ctx_t *ctx) {
     if (!ctx) return;
+    threadpool_destroy(ctx->verify->pool);
     arena_destroy(ctx->arena);
 }
 
@@ -306,3 +323,16 @@ bool tetsuo_verify_exclusion(
 
     return verify_exclusion_proof(root, &leaf_field, proof, proof_len);
 }
+
+uint32_t tetsuo_cpu_features(void) {
+    uint32_t selected = 0;
+#ifdef TETSUO_X64_ASM
+    if ((cpu_features() & CPU_MULX_ADX) == CPU_MULX_ADX) {
+        selected |= TETSUO_CPU_MULX_ADX;
+    }
+#endif
+    if (field_ifma_available()) {
+        selected |= TETSUO_CPU_AVX512_IFMA;
+    }
+    return selected;
+}
@@ -0,0 +1,20 @@
+/*
+ * CPU feature detection
+ */
+
+#include "cpu.h"
+#include <stdatomic.h>
+
+/* Detected features, with bit 31 set once filled in */
+#define CPU_DETECTED (1u << 31)
+
+static _Atomic(uint32_t) g_cpu_features;
+
+uint32_t cpu_features(void) {
+    uint32_t f = atomic_load_explicit(&g_cpu_features, memory_order_relaxed);
+    if (!(f & CPU_DETECTED)) {
+        f = cpu_detect() | CPU_DETECTED;
+        atomic_store_explicit(&g_cpu_features, f, memory_order_relaxed);
+    }
+    return f & ~CPU_DETECTED;
+}
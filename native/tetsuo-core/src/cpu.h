@@ -0,0 +1,110 @@
+/*
+ * CPU feature detection and kernel dispatch (internal)
+ *
+ * One binary carries every kernel. cpu_detect() reads CPUID, plus XGETBV
+ * for the AVX register state the OS actually saves, and the hot entry
+ * points bind to the best implementation once, at load time, through a
+ * constructor-filled pointer. The pointer starts at the portable kernel
+ * so early callers are still correct.
+ *
+ * Not GNU ifunc: an ifunc symbol shares its resolver's address, and
+ * under -flto GCC's IPA reads the resolver's side-effect-free body as the
+ * function's and deletes the calls. A pointer written by a constructor is
+ * opaque to it.
+ *
+ * Build with TETSUO_NO_ASM to compile only the portable kernels.
+ */
+
+#ifndef TETSUO_CPU_H
+#define TETSUO_CPU_H
+
+#include <stdint.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(TETSUO_NO_ASM)
+#define TETSUO_X64_ASM 1
+#endif
+
+#define CPU_BMI2        (1u << 0)
+#define CPU_ADX         (1u << 1)
+#define CPU_AVX2        (1u << 2)
+#define CPU_AVX512F     (1u << 3)
+#define CPU_AVX512IFMA  (1u << 4)
+
+/* Needed by the MULX/ADCX/ADOX multiply in mont.h */
+#define CPU_MULX_ADX    (CPU_BMI2 | CPU_ADX)
+
+/*
+ * Raw detection: inline asm only, no relocations, no libc and no
+ * sanitizer instrumentation, so it is safe from constructors that run
+ * before the ASan runtime is up. Everything else should use
+ * cpu_features().
+ */
+#ifdef TETSUO_X64_ASM
+
+#define CPU_NO_SANITIZE __attribute__((no_sanitize_address))
+
+static inline CPU_NO_SANITIZE void cpu_cpuid(uint32_t leaf, uint32_t sub, uint32_t r[4]) {
+    __asm__ ("cpuid"
+             : "=a" (r[0]), "=b" (r[1]), "=c" (r[2]), "=d" (r[3])
+             : "a" (leaf), "c" (sub));
+}
+
+static inline CPU_NO_SANITIZE uint32_t cpu_detect(void) {
+    uint32_t f = 0, r[4];
+
+    cpu_cpuid(0, 0, r);
+    if (r[0] < 7) return 0;
+
+    /* XCR0: SSE|AVX state for ymm, plus opmask|ZMM_Hi256|Hi16_ZMM for zmm */
+    cpu_cpuid(1, 0, r);
+    uint64_t xcr0 = 0;
+    if ((r[2] & (1u << 27)) && (r[2] & (1u << 28))) {
+        uint32_t lo, hi;
+        __asm__ ("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+        xcr0 = ((uint64_t)hi << 32) | lo;
+    }
+    int ymm = (xcr0 & 0x06) == 0x06;
+    int zmm = (xcr0 & 0xe6) == 0xe6;
+
+    cpu_cpuid(7, 0, r);
+    if (r[1] & (1u << 8)) f |= CPU_BMI2;
+    if (r[1] & (1u << 19)) f |= CPU_ADX;
+    if (ymm && (r[1] & (1u << 5))) f |= CPU_AVX2;
+    if (zmm && (r[1] & (1u << 16))) {
+        f |= CPU_AVX512F;
+        if (r[1] & (1u << 21)) f |= CPU_AVX512IFMA;
+    }
+    return f;
+}
+
+#else
+
+static inline uint32_t cpu_detect(void) {
+    return 0;
+}
+
+#endif /* TETSUO_X64_ASM */
+
+/* Cached cpu_detect() */
+uint32_t cpu_features(void);
+
+/*
+ * Bind a void function `name` to the kernel returned by `resolver`, a
+ * static function of no arguments defined earlier in the same file.
+ * `params` and `args` are the parenthesised parameter and argument
+ * lists; `fallback` is the kernel used until the constructor runs.
+ */
+#ifdef TETSUO_X64_ASM
+
+#define CPU_RESOLVER static CPU_NO_SANITIZE
+
+#define CPU_DISPATCH(name, params, args, resolver, fallback) \
+    static __typeof__(resolver()) name##_kernel = fallback; \
+    __attribute__((constructor)) static void name##_bind(void) { \
+        name##_kernel = resolver(); \
+    } \
+    void name params { name##_kernel args; }
+
+#endif
+
+#endif /* TETSUO_CPU_H */
@@ -1,386 +1,262 @@
 /*
- * BN254 field arithmetic - Montgomery form, x86-64 fast path
+ * BN254 field arithmetic - Montgomery form (backend in mont.h)
  */
 
 #include "field.h"
+#include "field_ifma.h"
 #include "arena.h"
+#include "mont.h"
+#include "safegcd.h"
 #include <stdlib.h>
+#include <string.h>
 
-#if defined(__x86_64__) && defined(__BMI2__)
-#define USE_ASM_X64 1
-#else
-#define USE_ASM_X64 0
-#endif
-
-#if USE_ASM_X64
-
-static inline uint64_t add_256(uint64_t *r, const uint64_t *a, const uint64_t *b) {
-    uint64_t carry;
-    __asm__ volatile (
-        "movq   (%[a]), %%rax\n\t"
-        "addq   (%[b]), %%rax\n\t"
-        "movq   %%rax, (%[r])\n\t"
-        "movq   8(%[a]), %%rax\n\t"
-        "adcq   8(%[b]), %%rax\n\t"
-        "movq   %%rax, 8(%[r])\n\t"
-        "movq   16(%[a]), %%rax\n\t"
-        "adcq   16(%[b]), %%rax\n\t"
-        "movq   %%rax, 16(%[r])\n\t"
-        "movq   24(%[a]), %%rax\n\t"
-        "adcq   24(%[b]), %%rax\n\t"
-        "movq   %%rax, 24(%[r])\n\t"
-        "setc   %%al\n\t"
-        "movzbq %%al, %[carry]"
-        : [carry] "=r" (carry)
-        : [r] "r" (r), [a] "r" (a), [b] "r" (b)
-        : "rax", "memory", "cc"
-    );
-    return carry;
-}
-
-static inline uint64_t sub_256(uint64_t *r, const uint64_t *a, const uint64_t *b) {
-    uint64_t borrow;
-    __asm__ volatile (
-        "movq   (%[a]), %%rax\n\t"
-        "subq   (%[b]), %%rax\n\t"
-        "movq   %%rax, (%[r])\n\t"
-        "movq   8(%[a]), %%rax\n\t"
-        "sbbq   8(%[b]), %%rax\n\t"
-        "movq   %%rax, 8(%[r])\n\t"
-        "movq   16(%[a]), %%rax\n\t"
-        "sbbq   16(%[b]), %%rax\n\t"
-        "movq   %%rax, 16(%[r])\n\t"
-        "movq   24(%[a]), %%rax\n\t"
-        "sbbq   24(%[b]), %%rax\n\t"
-        "movq   %%rax, 24(%[r])\n\t"
-        "setc   %%al\n\t"
-        "movzbq %%al, %[borrow]"
-        : [borrow] "=r" (borrow)
-        : [r] "r" (r), [a] "r" (a), [b] "r" (b)
-        : "rax", "memory", "cc"
-    );
-    return borrow;
-}
-
-static void mont_reduce(uint64_t *r, uint64_t *t) {
-    uint64_t k, tmp[4];
+void field_add(field_t *r, const field_t *a, const field_t *b) {
+    mont_add_mod(r->limbs, a->limbs, b->limbs, FIELD_MODULUS);
+}
 
-    for (int i = 0; i < 4; i++) {
-        k = t[i] * FIELD_INV;
-
-        __asm__ volatile (
-            "movq   %[k], %%rdx\n\t"
-            "mulxq  %[p0], %%rax, %%rcx\n\t"
-            "addq   %%rax, %[t0]\n\t"
-            "mulxq  %[p1], %%rax, %%r8\n\t"
-            "adcq   %%rcx, %%rax\n\t"
-            "addq   %%rax, %[t1]\n\t"
-            "mulxq  %[p2], %%rax, %%rcx\n\t"
-            "adcq   %%r8, %%rax\n\t"
-            "addq   %%rax, %[t2]\n\t"
-            "mulxq  %[p3], %%rax, %%r8\n\t"
-            "adcq   %%rcx, %%rax\n\t"
-            "addq   %%rax, %[t3]\n\t"
-            "adcq   %%r8, %[t4]\n\t"
-            "adcq   $0, %[t5]\n\t"
-            "adcq   $0, %[t6]\n\t"
-            "adcq   $0, %[t7]"
-            : [t0] "+r" (t[i]), [t1] "+r" (t[i+1]), [t2] "+r" (t[i+2]),
-              [t3] "+r" (t[i+3]), [t4] "+r" (t[i+4]), [t5] "+r" (t[i+5]),
-              [t6] "+r" (t[i+6]), [t7] "+r" (t[i+7])
-            : [k] "r" (k),
-              [p0] "m" (FIELD_MODULUS[0]), [p1] "m" (FIELD_MODULUS[1]),
-              [p2] "m" (FIELD_MODULUS[2]), [p3] "m" (FIELD_MODULUS[3])
-            : "rax", "rcx", "rdx", "r8", "cc"
-        );
-    }
+void field_sub(field_t *r, const field_t *a, const field_t *b) {
+    mont_sub_mod(r->limbs, a->limbs, b->limbs, FIELD_MODULUS);
+}
+
+/* Multiply and square kernels, bound at load time (cpu.h) */
+
+typedef void (*field_mul_fn)(field_t *r, const field_t *a, const field_t *b);
+typedef void (*field_sqr_fn)(field_t *r, const field_t *a);
+
+static void field_mul_c(field_t *r, const field_t *a, const field_t *b) {
+    uint64_t t[8];
+    mont_mul_256x256_c(t, a->limbs, b->limbs);
+    mont_reduce_c(r->limbs, t, FIELD_MODULUS, FIELD_INV);
+}
+
+static void field_sqr_c(field_t *r, const field_t *a) {
+    uint64_t t[8];
+    mont_sqr_256_c(t, a->limbs);
+    mont_reduce_c(r->limbs, t, FIELD_MODULUS, FIELD_INV);
+}
 
-    r[0] = t[4]; r[1] = t[5]; r[2] = t[6]; r[3] = t[7];
-
-    uint64_t borrow = sub_256(tmp, r, FIELD_MODULUS);
-    /* If no borrow (borrow=0), r >= p, use tmp. If borrow (borrow=1), r < p, keep r */
-    uint64_t mask = borrow - 1;  /* 0 if borrow, all 1s if no borrow */
-    r[0] = (r[0] & ~mask) | (tmp[0] & mask);
-    r[1] = (r[1] & ~mask) | (tmp[1] & mask);
-    r[2] = (r[2] & ~mask) | (tmp[2] & mask);
-    r[3] = (r[3] & ~mask) | (tmp[3] & mask);
-}
-
-static void mul_256x256(uint64_t *r, const uint64_t *a, const uint64_t *b) {
-    uint64_t t0, t1, t2, t3, t4, t5, t6, t7;
-    uint64_t c0, c1, c2;
-
-    __asm__ volatile (
-        "movq   (%[a]), %%rdx\n\t"
-        "mulxq  (%[b]), %[t0], %[c0]\n\t"
-        "mulxq  8(%[b]), %[t1], %[c1]\n\t"
-        "addq   %[c0], %[t1]\n\t"
-        "mulxq  16(%[b]), %[t2], %[c0]\n\t"
-        "adcq   %[c1], %[t2]\n\t"
-        "mulxq  24(%[b]), %[t3], %[t4]\n\t"
-        "adcq   %[c0], %[t3]\n\t"
-        "adcq   $0, %[t4]\n\t"
-
-        "movq   8(%[a]), %%rdx\n\t"
-        "xorq   %[t5], %[t5]\n\t"
-        "mulxq  (%[b]), %[c0], %[c1]\n\t"
-        "addq   %[c0], %[t1]\n\t"
-        "mulxq  8(%[b]), %[c0], %[c2]\n\t"
-        "adcq   %[c1], %[c0]\n\t"
-        "addq   %[c0], %[t2]\n\t"
-        "mulxq  16(%[b]), %[c0], %[c1]\n\t"
-        "adcq   %[c2], %[c0]\n\t"
-        "addq   %[c0], %[t3]\n\t"
-        "mulxq  24(%[b]), %[c0], %[c2]\n\t"
-        "adcq   %[c1], %[c0]\n\t"
-        "addq   %[c0], %[t4]\n\t"
-        "adcq   %[c2], %[t5]\n\t"
-
-        "movq   16(%[a]), %%rdx\n\t"
-        "xorq   %[t6], %[t6]\n\t"
-        "mulxq  (%[b]), %[c0], %[c1]\n\t"
-        "addq   %[c0], %[t2]\n\t"
-        "mulxq  8(%[b]), %[c0], %[c2]\n\t"
-        "adcq   %[c1], %[c0]\n\t"
-        "addq   %[c0], %[t3]\n\t"
-        "mulxq  16(%[b]), %[c0], %[c1]\n\t"
-        "adcq   %[c2], %[c0]\n\t"
-        "addq   %[c0], %[t4]\n\t"
-        "mulxq  24(%[b]), %[c0], %[c2]\n\t"
-        "adcq   %[c1], %[c0]\n\t"
-        "addq   %[c0], %[t5]\n\t"
-        "adcq   %[c2], %[t6]\n\t"
-
-        "movq   24(%[a]), %%rdx\n\t"
-        "xorq   %[t7], %[t7]\n\t"
-        "mulxq  (%[b]), %[c0], %[c1]\n\t"
-        "addq   %[c0], %[t3]\n\t"
-        "mulxq  8(%[b]), %[c0], %[c2]\n\t"
-        "adcq   %[c1], %[c0]\n\t"
-        "addq   %[c0], %[t4]\n\t"
-        "mulxq  16(%[b]), %[c0], %[c1]\n\t"
-        "adcq   %[c2], %[c0]\n\t"
-        "addq   %[c0], %[t5]\n\t"
-        "mulxq  24(%[b]), %[c0], %[c2]\n\t"
-        "adcq   %[c1], %[c0]\n\t"
-        "addq   %[c0], %[t6]\n\t"
-        "adcq   %[c2], %[t7]"
-
-        : [t0] "=&r" (t0), [t1] "=&r" (t1), [t2] "=&r" (t2), [t3] "=&r" (t3),
-          [t4] "=&r" (t4), [t5] "=&r" (t5), [t6] "=&r" (t6), [t7] "=&r" (t7),
-          [c0] "=&r" (c0), [c1] "=&r" (c1), [c2] "=&r" (c2)
-        : [a] "r" (a), [b] "r" (b)
-        : "rdx", "cc"
-    );
-
-    r[0] = t0; r[1] = t1; r[2] = t2; r[3] = t3;
-    r[4] = t4; r[5] = t5; r[6] = t6; r[7] = t7;
-}
-
-static void sqr_256(uint64_t *r, const uint64_t *a) {
-    uint64_t t0, t1, t2, t3, t4, t5, t6, t7;
-    uint64_t c0, c1, c2;
-
-    __asm__ volatile (
-        "movq   (%[a]), %%rdx\n\t"
-        "mulxq  %%rdx, %[t0], %[t1]\n\t"
-        "mulxq  8(%[a]), %[c0], %[c1]\n\t"
-        "mulxq  16(%[a]), %[t2], %[t3]\n\t"
-        "mulxq  24(%[a]), %[t4], %[t5]\n\t"
-
-        "addq   %[c0], %[c0]\n\t"
-        "adcq   %[c1], %[t2]\n\t"
-        "adcq   $0, %[t3]\n\t"
-        "addq   %[c0], %[t1]\n\t"
-        "adcq   %[c1], %[t2]\n\t"
-
-        "movq   8(%[a]), %%rdx\n\t"
-        "mulxq  %%rdx, %[c0], %[c1]\n\t"
-        "addq   %[c0], %[t2]\n\t"
-        "adcq   %[c1], %[t3]\n\t"
-        "mulxq  16(%[a]), %[c0], %[c1]\n\t"
-        "addq   %[c0], %[c0]\n\t"
-        "adcq   %[c1], %[c1]\n\t"
-        "addq   %[c0], %[t3]\n\t"
-        "adcq   %[c1], %[t4]\n\t"
-        "mulxq  24(%[a]), %[c0], %[c1]\n\t"
-        "addq   %[c0], %[c0]\n\t"
-        "adcq   %[c1], %[c1]\n\t"
-        "addq   %[c0], %[t4]\n\t"
-        "adcq   %[c1], %[t5]\n\t"
-
-        "movq   16(%[a]), %%rdx\n\t"
-        "mulxq  %%rdx, %[c0], %[c1]\n\t"
-        "xorq   %[t6], %[t6]\n\t"
-        "addq   %[c0], %[t4]\n\t"
-        "adcq   %[c1], %[t5]\n\t"
-        "mulxq  24(%[a]), %[c0], %[c1]\n\t"
-        "addq   %[c0], %[c0]\n\t"
-        "adcq   %[c1], %[c1]\n\t"
-        "addq   %[c0], %[t5]\n\t"
-        "adcq   %[c1], %[t6]\n\t"
-
-        "movq   24(%[a]), %%rdx\n\t"
-        "mulxq  %%rdx, %[c0], %[t7]\n\t"
-        "addq   %[c0], %[t6]\n\t"
-        "adcq   $0, %[t7]"
-
-        : [t0] "=&r" (t0), [t1] "=&r" (t1), [t2] "=&r" (t2), [t3] "=&r" (t3),
-          [t4] "=&r" (t4), [t5] "=&r" (t5), [t6] "=&r" (t6), [t7] "=&r" (t7),
-          [c0] "=&r" (c0), [c1] "=&r" (c1), [c2] "=&r" (c2)
-        : [a] "r" (a)
-        : "rdx", "cc"
-    );
-
-    r[0] = t0; r[1] = t1; r[2] = t2; r[3] = t3;
-    r[4] = t4; r[5] = t5; r[6] = t6; r[7] = t7;
+#ifdef TETSUO_X64_ASM
+
+static void field_mul_adx(field_t *r, const field_t *a, const field_t *b) {
+    uint64_t t[8];
+    mont_mul_256x256_adx(t, a->limbs, b->limbs);
+    mont_reduce_adx(r->limbs, t, FIELD_MODULUS, FIELD_INV);
+}
+
+static void field_sqr_adx(field_t *r, const field_t *a) {
+    uint64_t t[8];
+    mont_sqr_256_adx(t, a->limbs);
+    mont_reduce_adx(r->limbs, t, FIELD_MODULUS, FIELD_INV);
 }
 
+CPU_RESOLVER field_mul_fn field_mul_resolve(void) {
+    return (cpu_detect() & CPU_MULX_ADX) == CPU_MULX_ADX ? field_mul_adx : field_mul_c;
+}
+
+CPU_RESOLVER field_sqr_fn field_sqr_resolve(void) {
+    return (cpu_detect() & CPU_MULX_ADX) == CPU_MULX_ADX ? field_sqr_adx : field_sqr_c;
+}
+
+CPU_DISPATCH(field_mul, (field_t *r, const field_t *a, const field_t *b), (r, a, b),
+             field_mul_resolve, field_mul_c)
+CPU_DISPATCH(field_sqr, (field_t *r, const field_t *a), (r, a),
+             field_sqr_resolve, field_sqr_c)
+
 #else
 
-static inline uint64_t add_256(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+void field_mul(field_t *r, const field_t *a, const field_t *b) {
+    field_mul_c(r, a, b);
+}
+
+void field_sqr(field_t *r, const field_t *a) {
+    field_sqr_c(r, a);
+}
+
+#endif /* TETSUO_X64_ASM */
+
+/*
+ * Lazy reduction. With T < p·2^256 the reduction computes (T + k·p)/2^256
+ * with k < 2^256, which stays below 2p, so the kernels' single
+ * conditional subtraction is enough.
+ */
+
+static void wide_add(uint64_t r[8], const uint64_t a[8], const uint64_t b[8]) {
     __uint128_t acc = 0;
-    for (int i = 0; i < 4; i++) {
+    for (int i = 0; i < 8; i++) {
         acc += (__uint128_t)a[i] + b[i];
         r[i] = (uint64_t)acc;
         acc >>= 64;
     }
-    return (uint64_t)acc;
 }
 
-static inline uint64_t sub_256(uint64_t *r, const uint64_t *a, const uint64_t *b) {
-    __int128_t acc = 0;
+void field_wide_add(field_wide_t *r, const field_wide_t *a, const field_wide_t *b) {
+    wide_add(r->limbs, a->limbs, b->limbs);
+}
+
+/* a - b, plus p·2^256 on borrow (a multiple of p, so it reduces away) */
+void field_wide_sub(field_wide_t *r, const field_wide_t *a, const field_wide_t *b) {
+    uint64_t borrow = 0;
+    for (int i = 0; i < 8; i++) {
+        uint64_t d = a->limbs[i] - b->limbs[i];
+        uint64_t out = d - borrow;
+        borrow = (a->limbs[i] < b->limbs[i]) | (d < borrow);
+        r->limbs[i] = out;
+    }
+
+    uint64_t mask = -borrow;
+    __uint128_t acc = 0;
     for (int i = 0; i < 4; i++) {
-        acc += (__int128_t)a[i] - b[i];
-        r[i] = (uint64_t)acc;
+        acc += (__uint128_t)r->limbs[i + 4] + (FIELD_MODULUS[i] & mask);
+        r->limbs[i + 4] = (uint64_t)acc;
         acc >>= 64;
     }
-    return (acc < 0) ? 1 : 0;
 }
 
-static void mul_256x256(uint64_t *r, const uint64_t *a, const uint64_t *b) {
-    __uint128_t acc;
-    uint64_t carry = 0;
-
-    for (int i = 0; i < 8; i++) r[i] = 0;
-
-    for (int i = 0; i < 4; i++) {
-        carry = 0;
-        for (int j = 0; j < 4; j++) {
-            acc = (__uint128_t)a[i] * b[j] + r[i + j] + carry;
-            r[i + j] = (uint64_t)acc;
-            carry = (uint64_t)(acc >> 64);
+/* Product and reduction kernels, inlined into each variant below */
+typedef void (*wide_mul_fn)(uint64_t *r, const uint64_t *a, const uint64_t *b);
+typedef void (*wide_reduce_fn)(uint64_t *r, uint64_t *t, const uint64_t *m, uint64_t inv);
+
+static inline __attribute__((always_inline))
+void sum_of_products(field_t *r, const field_t *a, const field_t *b, size_t n,
+                     wide_mul_fn mul, wide_reduce_fn reduce) {
+    field_t sum;
+
+    field_set_zero(&sum);
+    while (n > 0) {
+        size_t terms = n < FIELD_WIDE_MAX_TERMS ? n : FIELD_WIDE_MAX_TERMS;
+        uint64_t acc[8], prod[8];
+        field_t part;
+
+        mul(acc, a[0].limbs, b[0].limbs);
+        for (size_t i = 1; i < terms; i++) {
+            mul(prod, a[i].limbs, b[i].limbs);
+            wide_add(acc, acc, prod);
         }
-        r[i + 4] = carry;
+        reduce(part.limbs, acc, FIELD_MODULUS, FIELD_INV);
+        field_add(&sum, &sum, &part);
+
+        a += terms;
+        b += terms;
+        n -= terms;
     }
+    *r = sum;
 }
 
-static void sqr_256(uint64_t *r, const uint64_t *a) {
-    mul_256x256(r, a, a);
+typedef void (*field_wide_mul_fn)(field_wide_t *r, const field_t *a, const field_t *b);
+typedef void (*field_wide_reduce_fn)(field_t *r, const field_wide_t *a);
+typedef void (*field_sop_fn)(field_t *r, const field_t *a, const field_t *b, size_t n);
+
+static void field_wide_mul_c(field_wide_t *r, const field_t *a, const field_t *b) {
+    mont_mul_256x256_c(r->limbs, a->limbs, b->limbs);
 }
 
-static void mont_reduce(uint64_t *r, uint64_t *t) {
-    __uint128_t acc;
-    uint64_t k, carry;
+static void field_wide_reduce_c(field_t *r, const field_wide_t *a) {
+    uint64_t t[8];
+    memcpy(t, a->limbs, sizeof(t));
+    mont_reduce_c(r->limbs, t, FIELD_MODULUS, FIELD_INV);
+}
 
-    for (int i = 0; i < 4; i++) {
-        k = t[i] * FIELD_INV;
-        carry = 0;
-        for (int j = 0; j < 4; j++) {
-            acc = (__uint128_t)k * FIELD_MODULUS[j] + t[i + j] + carry;
-            t[i + j] = (uint64_t)acc;
-            carry = (uint64_t)(acc >> 64);
-        }
-        for (int j = i + 4; j < 8 && carry; j++) {
-            acc = (__uint128_t)t[j] + carry;
-            t[j] = (uint64_t)acc;
-            carry = (uint64_t)(acc >> 64);
-        }
-    }
+static void field_sop_c(field_t *r, const field_t *a, const field_t *b, size_t n) {
+    sum_of_products(r, a, b, n, mont_mul_256x256_c, mont_reduce_c);
+}
 
-    r[0] = t[4]; r[1] = t[5]; r[2] = t[6]; r[3] = t[7];
+#ifdef TETSUO_X64_ASM
 
-    uint64_t tmp[4];
-    uint64_t borrow = sub_256(tmp, r, FIELD_MODULUS);
-    uint64_t mask = borrow - 1;
-    r[0] = (r[0] & ~mask) | (tmp[0] & mask);
-    r[1] = (r[1] & ~mask) | (tmp[1] & mask);
-    r[2] = (r[2] & ~mask) | (tmp[2] & mask);
-    r[3] = (r[3] & ~mask) | (tmp[3] & mask);
+static void field_wide_mul_adx(field_wide_t *r, const field_t *a, const field_t *b) {
+    mont_mul_256x256_adx(r->limbs, a->limbs, b->limbs);
 }
 
-#endif
+static void field_wide_reduce_adx(field_t *r, const field_wide_t *a) {
+    uint64_t t[8];
+    memcpy(t, a->limbs, sizeof(t));
+    mont_reduce_adx(r->limbs, t, FIELD_MODULUS, FIELD_INV);
+}
 
-void field_add(field_t *r, const field_t *a, const field_t *b) {
-    uint64_t tmp[4];
-    uint64_t carry = add_256(r->limbs, a->limbs, b->limbs);
-    uint64_t borrow = sub_256(tmp, r->limbs, FIELD_MODULUS);
-    /* If carry or no borrow, use reduced result */
-    /* carry=1 means definitely >= p, borrow=0 means r >= p */
-    uint64_t use_reduced = carry | (borrow ^ 1);
-    uint64_t mask = -(uint64_t)use_reduced;
-    r->limbs[0] = (r->limbs[0] & ~mask) | (tmp[0] & mask);
-    r->limbs[1] = (r->limbs[1] & ~mask) | (tmp[1] & mask);
-    r->limbs[2] = (r->limbs[2] & ~mask) | (tmp[2] & mask);
-    r->limbs[3] = (r->limbs[3] & ~mask) | (tmp[3] & mask);
+static void field_sop_adx(field_t *r, const field_t *a, const field_t *b, size_t n) {
+    sum_of_products(r, a, b, n, mont_mul_256x256_adx, mont_reduce_adx);
 }
 
-void field_sub(field_t *r, const field_t *a, const field_t *b) {
-    uint64_t tmp[4];
-    uint64_t borrow = sub_256(r->limbs, a->limbs, b->limbs);
-    add_256(tmp, r->limbs, FIELD_MODULUS);
-    /* If borrow, use corrected result */
-    uint64_t mask = -(uint64_t)borrow;
-    r->limbs[0] = (r->limbs[0] & ~mask) | (tmp[0] & mask);
-    r->limbs[1] = (r->limbs[1] & ~mask) | (tmp[1] & mask);
-    r->limbs[2] = (r->limbs[2] & ~mask) | (tmp[2] & mask);
-    r->limbs[3] = (r->limbs[3] & ~mask) | (tmp[3] & mask);
+CPU_RESOLVER field_wide_mul_fn field_wide_mul_resolve(void) {
+    return (cpu_detect() & CPU_MULX_ADX) == CPU_MULX_ADX ? field_wide_mul_adx : field_wide_mul_c;
 }
 
-void field_mul(field_t *r, const field_t *a, const field_t *b) {
-    uint64_t t[8];
-    mul_256x256(t, a->limbs, b->limbs);
-    mont_reduce(r->limbs, t);
+CPU_RESOLVER field_wide_reduce_fn field_wide_reduce_resolve(void) {
+    return (cpu_detect() & CPU_MULX_ADX) == CPU_MULX_ADX ? field_wide_reduce_adx : field_wide_reduce_c;
 }
 
-void field_sqr(field_t *r, const field_t *a) {
-    uint64_t t[8];
-    sqr_256(t, a->limbs);
-    mont_reduce(r->limbs, t);
+CPU_RESOLVER field_sop_fn field_sop_resolve(void) {
+    return (cpu_detect() & CPU_MULX_ADX) == CPU_MULX_ADX ? field_sop_adx : field_sop_c;
+}
+
+CPU_DISPATCH(field_wide_mul, (field_wide_t *r, const field_t *a, const field_t *b), (r, a, b),
+             field_wide_mul_resolve, field_wide_mul_c)
+CPU_DISPATCH(field_wide_reduce, (field_t *r, const field_wide_t *a), (r, a),
+             field_wide_reduce_resolve, field_wide_reduce_c)
+CPU_DISPATCH(field_sum_of_products, (field_t *r, const field_t *a, const field_t *b, size_t n),
+             (r, a, b, n), field_sop_resolve, field_sop_c)
+
+#else
+
+void field_wide_mul(field_wide_t *r, const field_t *a, const field_t *b) {
+    field_wide_mul_c(r, a, b);
+}
+
+void field_wide_reduce(field_t *r, const field_wide_t *a) {
+    field_wide_reduce_c(r, a);
+}
+
+void field_sum_of_products(field_t *r, const field_t *a, const field_t *b, size_t n) {
+    field_sop_c(r, a, b, n);
+}
+
+#endif /* TETSUO_X64_ASM */
+
+void field_wide_mac(field_wide_t *r, const field_t *a, const field_t *b) {
+    field_wide_t prod;
+    field_wide_mul(&prod, a, b);
+    wide_add(r->limbs, r->limbs, prod.limbs);
 }
 
 void field_neg(field_t *r, const field_t *a) {
     if (field_is_zero(a)) {
         field_set_zero(r);
     } else {
-        sub_256(r->limbs, FIELD_MODULUS, a->limbs);
+        mont_sub_256(r->limbs, FIELD_MODULUS, a->limbs);
     }
 }
 
-void field_inv(field_t *r, const field_t *a) {
-    static const uint64_t exp[4] = {
-        0x3C208C16D87CFD45ULL,
-        0x97816A916871CA8DULL,
-        0xB85045B68181585DULL,
-        0x30644E72E131A029ULL
-    };
-
-    field_t base, result;
-    field_copy(&base, a);
-    field_set_one(&result);
+/*
+ * Inversion by safegcd (safegcd.c). The input is x = a·R, so the plain
+ * inverse is a⁻¹·R⁻¹; one Montgomery multiplication by R³ gives a⁻¹·R.
+ */
+static const safegcd_modinfo_t FIELD_MODINFO = {
+    {{0x3C208C16D87CFD47LL, 0x1E05AA45A1C72A34LL, 0x05045B68181585D9LL,
+      0x19139CB84C680A6ELL, 0x30LL}},
+    0x382DF87D1B799C77ULL
+};
+
+/* R³ mod p */
+static const field_t FIELD_R3 = {{
+    0xB1CD6DAFDA1530DFULL,
+    0x62F210E6A7283DB6ULL,
+    0xEF7F0B0C0ADA0AFBULL,
+    0x20FD6E902D592544ULL
+}};
 
-    for (int i = 0; i < 4; i++) {
-        uint64_t e = exp[i];
-        for (int j = 0; j < 64; j++) {
-            if (e & 1) {
-                field_mul(&result, &result, &base);
-            }
-            field_sqr(&base, &base);
-            e >>= 1;
-        }
-    }
+void field_inv(field_t *r, const field_t *a) {
+    signed62_t x;
+    signed62_from_u256(&x, a->limbs);
+    safegcd_inv(&x, &FIELD_MODINFO);
+    signed62_to_u256(r->limbs, &x);
+    field_mul(r, r, &FIELD_R3);
+}
 
-    field_copy(r, &result);
+void field_inv_vartime(field_t *r, const field_t *a) {
+    signed62_t x;
+    signed62_from_u256(&x, a->limbs);
+    safegcd_inv_vartime(&x, &FIELD_MODINFO);
+    signed62_to_u256(r->limbs, &x);
+    field_mul(r, r, &FIELD_R3);
 }
 
 void field_batch_inv(field_t *r, const field_t *a, size_t count) {
@@ -390,6 +266,18 @@ void field_batch_inv(field_t *r, const field_t *a, size_t count) {
         return;
     }
 
+    /*
+     * Whole lane groups go to the IFMA kernel; a short tail costs one
+     * more inversion, so only take the vector path for larger batches.
+     */
+    if (count >= 4 * FIELD_IFMA_LANES && field_ifma_available()) {
+        size_t head = count - count % FIELD_IFMA_LANES;
+        if (field_batch_inv_ifma(r, a, head)) {
+            field_batch_inv(&r[head], &a[head], count - head);
+            return;
+        }
+    }
+
     /* Use scratch arena for temporary allocation */
     arena_t *scratch = scratch_arena_get();
     arena_checkpoint_t cp = arena_checkpoint(scratch);
@@ -412,9 +300,12 @@ void field_batch_inv(field_t *r, const field_t *a, size_t count) {
     field_t inv_all;
     field_inv(&inv_all, &acc[count-1]);
 
+    /* Read a[i] before writing r[i] so r may alias a */
     for (size_t i = count - 1; i > 0; i--) {
-        field_mul(&r[i], &inv_all, &acc[i-1]);
+        field_t t;
+        field_mul(&t, &inv_all, &acc[i-1]);
         field_mul(&inv_all, &inv_all, &a[i]);
+        field_copy(&r[i], &t);
     }
     field_copy(&r[0], &inv_all);
 
@@ -447,7 +338,7 @@ void field_to_mont(field_t *r, const field_t *a) {
 
 void field_from_mont(field_t *r, const field_t *a) {
     uint64_t t[8] = {a->limbs[0], a->limbs[1], a->limbs[2], a->limbs[3], 0, 0, 0, 0};
-    mont_reduce(r->limbs, t);
+    mont_reduce_c(r->limbs, t, FIELD_MODULUS, FIELD_INV);
 }
 
 bool field_eq(const field_t *a, const field_t *b) {
@@ -482,17 +373,139 @@ void field_copy(field_t *r, const field_t *a) {
 }
 
 int field_cmp(const field_t *a, const field_t *b) {
-    /* Constant-time comparison */
-    uint64_t gt = 0, lt = 0;
+    /* Constant-time comparison: borrows of a - b and b - a */
+    uint64_t t[4];
+    uint64_t lt = mont_sub_256(t, a->limbs, b->limbs);
+    uint64_t gt = mont_sub_256(t, b->limbs, a->limbs);
+    return (int)gt - (int)lt;
+}
+
+/* Variable time: exit at the first differing limb. Public data only. */
+
+bool field_eq_vartime(const field_t *a, const field_t *b) {
     for (int i = 3; i >= 0; i--) {
-        uint64_t a_gt_b = (b->limbs[i] - a->limbs[i]) >> 63;
-        uint64_t b_gt_a = (a->limbs[i] - b->limbs[i]) >> 63;
-        /* Only update if we haven't determined order yet */
-        uint64_t undecided = (gt | lt) ^ 1;
-        gt |= (a_gt_b & undecided);
-        lt |= (b_gt_a & undecided);
+        if (a->limbs[i] != b->limbs[i]) return false;
     }
-    return (int)gt - (int)lt;
+    return true;
+}
+
+int field_cmp_vartime(const field_t *a, const field_t *b) {
+    for (int i = 3; i >= 0; i--) {
+        if (a->limbs[i] != b->limbs[i]) return a->limbs[i] > b->limbs[i] ? 1 : -1;
+    }
+    return 0;
+}
+
+/*
+ * Fp2
+ */
+
+void fp2_add(fp2_t *r, const fp2_t *a, const fp2_t *b) {
+    field_add(&r->c0, &a->c0, &b->c0);
+    field_add(&r->c1, &a->c1, &b->c1);
+}
+
+void fp2_sub(fp2_t *r, const fp2_t *a, const fp2_t *b) {
+    field_sub(&r->c0, &a->c0, &b->c0);
+    field_sub(&r->c1, &a->c1, &b->c1);
+}
+
+void fp2_neg(fp2_t *r, const fp2_t *a) {
+    field_neg(&r->c0, &a->c0);
+    field_neg(&r->c1, &a->c1);
+}
+
+/*
+ * c0 = a0·b0 - a1·b1, c1 = (a0 + a1)(b0 + b1) - a0·b0 - a1·b1, all as
+ * wide values: each stays below p·2^256 (see field_wide_sub), so each
+ * coefficient is reduced once.
+ */
+void fp2_mul(fp2_t *r, const fp2_t *a, const fp2_t *b) {
+    field_wide_t t0, t1, t2;
+    field_t sa, sb;
+
+    field_add(&sa, &a->c0, &a->c1);
+    field_add(&sb, &b->c0, &b->c1);
+    field_wide_mul(&t0, &a->c0, &b->c0);
+    field_wide_mul(&t1, &a->c1, &b->c1);
+    field_wide_mul(&t2, &sa, &sb);
+
+    field_wide_sub(&t2, &t2, &t0);
+    field_wide_sub(&t2, &t2, &t1);
+    field_wide_sub(&t0, &t0, &t1);
+    field_wide_reduce(&r->c0, &t0);
+    field_wide_reduce(&r->c1, &t2);
+}
+
+/* c0 = (a0 + a1)(a0 - a1), c1 = 2·a0·a1 */
+void fp2_sqr(fp2_t *r, const fp2_t *a) {
+    field_t s, d, m;
+
+    field_add(&s, &a->c0, &a->c1);
+    field_sub(&d, &a->c0, &a->c1);
+    field_mul(&m, &a->c0, &a->c1);
+    field_mul(&r->c0, &s, &d);
+    field_add(&r->c1, &m, &m);
+}
+
+void fp2_mul_fp(fp2_t *r, const fp2_t *a, const field_t *b) {
+    field_mul(&r->c0, &a->c0, b);
+    field_mul(&r->c1, &a->c1, b);
+}
+
+/* (a0 + a1·u)(9 + u) = (9·a0 - a1) + (a0 + 9·a1)·u */
+void fp2_mul_by_nonresidue(fp2_t *r, const fp2_t *a) {
+    field_t n0, n1;
+
+    field_add(&n0, &a->c0, &a->c0);
+    field_add(&n0, &n0, &n0);
+    field_add(&n0, &n0, &n0);
+    field_add(&n0, &n0, &a->c0);
+    field_add(&n1, &a->c1, &a->c1);
+    field_add(&n1, &n1, &n1);
+    field_add(&n1, &n1, &n1);
+    field_add(&n1, &n1, &a->c1);
+
+    field_sub(&n0, &n0, &a->c1);
+    field_add(&r->c1, &n1, &a->c0);
+    r->c0 = n0;
+}
+
+/* 1/a = conj(a) / (a0² + a1²) */
+void fp2_inv(fp2_t *r, const fp2_t *a) {
+    field_wide_t w;
+    field_t norm;
+
+    field_wide_mul(&w, &a->c0, &a->c0);
+    field_wide_mac(&w, &a->c1, &a->c1);
+    field_wide_reduce(&norm, &w);
+    field_inv(&norm, &norm);
+    field_mul(&r->c0, &a->c0, &norm);
+    field_mul(&r->c1, &a->c1, &norm);
+    field_neg(&r->c1, &r->c1);
+}
+
+void fp2_frobenius(fp2_t *r, const fp2_t *a) {
+    r->c0 = a->c0;
+    field_neg(&r->c1, &a->c1);
+}
+
+bool fp2_eq(const fp2_t *a, const fp2_t *b) {
+    return field_eq(&a->c0, &b->c0) & field_eq(&a->c1, &b->c1);
+}
+
+bool fp2_is_zero(const fp2_t *a) {
+    return field_is_zero(&a->c0) & field_is_zero(&a->c1);
+}
+
+void fp2_set_zero(fp2_t *r) {
+    field_set_zero(&r->c0);
+    field_set_zero(&r->c1);
+}
+
+void fp2_set_one(fp2_t *r) {
+    field_set_one(&r->c0);
+    field_set_zero(&r->c1);
 }
 
 void field_from_bytes(field_t *r, const uint8_t *bytes) {
@@ -523,6 +536,15 @@ void field_to_bytes(uint8_t *bytes, const field_t *a) {
 }
 
 void field_batch_mul(field_t *r, const field_t *a, const field_t *b, size_t count) {
+    if (count >= FIELD_IFMA_LANES && field_ifma_available()) {
+        size_t head = count - count % FIELD_IFMA_LANES;
+        field_batch_mul_ifma(r, a, b, head);
+        r += head;
+        a += head;
+        b += head;
+        count -= head;
+    }
+
     size_t i = 0;
     for (; i + 4 <= count; i += 4) {
         field_mul(&r[i], &a[i], &b[i]);
@@ -535,6 +557,50 @@ void field_batch_mul(field_t *r, const field_t *a, const field_t *b, size_t coun
     }
 }
 
+void field_to_soa52(uint64_t *soa, const field_t *a, size_t count) {
+    const uint64_t mask = (1ULL << 52) - 1;
+    for (size_t i = 0; i < count; i++) {
+        const uint64_t *x = a[i].limbs;
+        soa[i] = x[0] & mask;
+        soa[count + i] = ((x[0] >> 52) | (x[1] << 12)) & mask;
+        soa[2 * count + i] = ((x[1] >> 40) | (x[2] << 24)) & mask;
+        soa[3 * count + i] = ((x[2] >> 28) | (x[3] << 36)) & mask;
+        soa[4 * count + i] = x[3] >> 16;
+    }
+}
+
+void field_from_soa52(field_t *r, const uint64_t *soa, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint64_t l0 = soa[i], l1 = soa[count + i], l2 = soa[2 * count + i];
+        uint64_t l3 = soa[3 * count + i], l4 = soa[4 * count + i];
+        r[i].limbs[0] = l0 | (l1 << 52);
+        r[i].limbs[1] = (l1 >> 12) | (l2 << 40);
+        r[i].limbs[2] = (l2 >> 24) | (l3 << 28);
+        r[i].limbs[3] = (l3 >> 36) | (l4 << 16);
+    }
+}
+
+void field_batch_mul_soa52(uint64_t *r, const uint64_t *a, const uint64_t *b, size_t count) {
+    size_t i = 0;
+    if (count >= FIELD_IFMA_LANES && field_ifma_available()) {
+        i = count - count % FIELD_IFMA_LANES;
+        field_batch_mul_soa52_ifma(r, a, b, i, count);
+    }
+
+    /* Tail through the scalar path, one column at a time */
+    for (; i < count; i++) {
+        field_t x, y;
+        uint64_t col[5];
+        for (int j = 0; j < 5; j++) col[j] = a[j * count + i];
+        field_from_soa52(&x, col, 1);
+        for (int j = 0; j < 5; j++) col[j] = b[j * count + i];
+        field_from_soa52(&y, col, 1);
+        field_mul(&x, &x, &y);
+        field_to_soa52(col, &x, 1);
+        for (int j = 0; j < 5; j++) r[j * count + i] = col[j];
+    }
+}
+
 void field_secure_zero(field_t *f) {
     volatile uint64_t *p = (volatile uint64_t *)f->limbs;
     p[0] = 0; p[1] = 0; p[2] = 0; p[3] = 0;
@@ -58,15 +58,38 @@ void field_add(field_t *r, const field_t *a, const field_t *b);
 void field_sub(field_t *r, const field_t *a, const field_t *b);
 void field_mul(field_t *r, const field_t *a, const field_t *b);
 void field_sqr(field_t *r, const field_t *a);
-void field_inv(field_t *r, const field_t *a);
+void field_inv(field_t *r, const field_t *a);          /* Constant time; 0 -> 0 */
+void field_inv_vartime(field_t *r, const field_t *a);  /* Public inputs only */
 void field_neg(field_t *r, const field_t *a);
 void field_pow(field_t *r, const field_t *a, const uint64_t *exp, size_t exp_len);
 
+/*
+ * Lazy reduction. A field_wide_t holds an unreduced 512-bit sum of
+ * products; field_wide_reduce runs a single Montgomery reduction on it and
+ * needs the value below p·2^256. 5p < 2^256, so any sum of up to
+ * FIELD_WIDE_MAX_TERMS products of reduced elements qualifies, and
+ * field_wide_sub keeps a qualifying value qualifying.
+ */
+#define FIELD_WIDE_MAX_TERMS 5
+
+typedef struct {
+    uint64_t limbs[8];
+} field_wide_t;
+
+void field_wide_mul(field_wide_t *r, const field_t *a, const field_t *b);  /* r = a·b */
+void field_wide_mac(field_wide_t *r, const field_t *a, const field_t *b);  /* r += a·b */
+void field_wide_add(field_wide_t *r, const field_wide_t *a, const field_wide_t *b);
+void field_wide_sub(field_wide_t *r, const field_wide_t *a, const field_wide_t *b);
+void field_wide_reduce(field_t *r, const field_wide_t *a);
+
+/* r = sum of a[i]·b[i], one reduction per FIELD_WIDE_MAX_TERMS products */
+void field_sum_of_products(field_t *r, const field_t *a, const field_t *b, size_t n);
+
 /* Montgomery conversion */
 void field_to_mont(field_t *r, const field_t *a);
 void field_from_mont(field_t *r, const field_t *a);
 
-/* Utility */
+/* Utility. field_eq and field_cmp are constant time. */
 bool field_eq(const field_t *a, const field_t *b);
 bool field_is_zero(const field_t *a);
 void field_set_zero(field_t *r);
@@ -74,10 +97,51 @@ void field_set_one(field_t *r);
 void field_copy(field_t *r, const field_t *a);
 int field_cmp(const field_t *a, const field_t *b);
 
-/* Batch operations (SIMD-accelerated) */
+/* Early-exit versions for public data (proofs, keys, public inputs) */
+bool field_eq_vartime(const field_t *a, const field_t *b);
+int field_cmp_vartime(const field_t *a, const field_t *b);
+
+/*
+ * Batch operations. Eight-lane AVX-512 IFMA kernels on CPUs that have
+ * it, scalar otherwise. field_batch_inv uses Montgomery's trick, so all
+ * inputs must be nonzero (a zero input zeroes other outputs too).
+ */
 void field_batch_mul(field_t *r, const field_t *a, const field_t *b, size_t count);
 void field_batch_inv(field_t *r, const field_t *a, size_t count);
 
+/*
+ * Structure-of-arrays layout for callers that keep vector-friendly data:
+ * limb j (52 bits) of element i lives at soa[j * count + i], j = 0..4.
+ * Values keep the field_t Montgomery form; only the radix changes.
+ */
+void field_to_soa52(uint64_t *soa, const field_t *a, size_t count);
+void field_from_soa52(field_t *r, const uint64_t *soa, size_t count);
+void field_batch_mul_soa52(uint64_t *r, const uint64_t *a, const uint64_t *b, size_t count);
+
+/*
+ * Fp2 = Fp[u]/(u² + 1), coefficients in Montgomery form. Multiplication
+ * is Karatsuba on unreduced products (two reductions, not three);
+ * squaring uses the complex method (two multiplications).
+ */
+typedef struct {
+    field_t c0;
+    field_t c1;
+} fp2_t;
+
+void fp2_add(fp2_t *r, const fp2_t *a, const fp2_t *b);
+void fp2_sub(fp2_t *r, const fp2_t *a, const fp2_t *b);
+void fp2_neg(fp2_t *r, const fp2_t *a);
+void fp2_mul(fp2_t *r, const fp2_t *a, const fp2_t *b);
+void fp2_sqr(fp2_t *r, const fp2_t *a);
+void fp2_mul_fp(fp2_t *r, const fp2_t *a, const field_t *b);
+void fp2_mul_by_nonresidue(fp2_t *r, const fp2_t *a);   /* ·(9 + u), the Fp6 non-residue */
+void fp2_inv(fp2_t *r, const fp2_t *a);                 /* Constant time; 0 -> 0 */
+void fp2_frobenius(fp2_t *r, const fp2_t *a);           /* a^p, the conjugate */
+bool fp2_eq(const fp2_t *a, const fp2_t *b);
+bool fp2_is_zero(const fp2_t *a);
+void fp2_set_zero(fp2_t *r);
+void fp2_set_one(fp2_t *r);
+
 /* Serialization */
 void field_from_bytes(field_t *r, const uint8_t *bytes);
 void field_to_bytes(uint8_t *bytes, const field_t *a);
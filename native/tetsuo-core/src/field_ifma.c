@@ -0,0 +1,127 @@
+/*
+ * BN254 field batch kernels - AVX-512 IFMA, eight lanes
+ *
+ * field_t inputs are regrouped into 5x52-bit limbs eight at a time. A
+ * product of two library values comes out of one IFMA multiplication as
+ * a·b·2^252, and a second multiplication by TO_R52 (2^264) puts it back
+ * at a·b·2^256, so batch_mul needs no domain conversion of its inputs.
+ */
+
+#include "field_ifma.h"
+#include "arena.h"
+#include "cpu.h"
+
+#ifdef TETSUO_HAVE_IFMA_KERNEL
+
+bool field_ifma_available(void) {
+    return (cpu_features() & CPU_AVX512IFMA) != 0;
+}
+
+__attribute__((target("avx512f,avx512ifma")))
+void field_batch_mul_ifma(field_t *r, const field_t *a, const field_t *b, size_t count) {
+    for (size_t i = 0; i < count; i += FIELD_IFMA_LANES) {
+        fe8_t x, y;
+        fe8_gather(&x, &a[i], 1);
+        fe8_gather(&y, &b[i], 1);
+        fe8_mul(&x, &x, &y);
+        fe8_mul_const(&x, &x, TO_R52);
+        fe8_scatter(&r[i], &x);
+    }
+}
+
+__attribute__((target("avx512f,avx512ifma")))
+void field_batch_mul_soa52_ifma(uint64_t *r, const uint64_t *a, const uint64_t *b,
+                                size_t count, size_t stride) {
+    for (size_t i = 0; i < count; i += FIELD_IFMA_LANES) {
+        fe8_t x, y;
+        for (int j = 0; j < 5; j++) {
+            x.l[j] = _mm512_loadu_si512(&a[j * stride + i]);
+            y.l[j] = _mm512_loadu_si512(&b[j * stride + i]);
+        }
+        fe8_mul(&x, &x, &y);
+        fe8_mul_const(&x, &x, TO_R52);
+        for (int j = 0; j < 5; j++) {
+            _mm512_storeu_si512(&r[j * stride + i], x.l[j]);
+        }
+    }
+}
+
+/*
+ * Montgomery's trick run as eight interleaved chains: lane k owns
+ * elements k, k+8, k+16, ... The eight chain products are inverted
+ * together with one field_inv; as in the scalar path, a zero input
+ * zeroes every output of the call.
+ */
+__attribute__((target("avx512f,avx512ifma")))
+bool field_batch_inv_ifma(field_t *r, const field_t *a, size_t count) {
+    size_t groups = count / FIELD_IFMA_LANES;
+
+    arena_t *scratch = scratch_arena_get();
+    arena_checkpoint_t cp = arena_checkpoint(scratch);
+    fe8_t *acc = arena_alloc_aligned(scratch, groups * sizeof(fe8_t), 64);
+    if (!acc) {
+        arena_restore(scratch, cp);
+        return false;
+    }
+
+    fe8_t x, run;
+    fe8_load(&run, a, 1);
+    acc[0] = run;
+    for (size_t g = 1; g < groups; g++) {
+        fe8_load(&x, &a[g * FIELD_IFMA_LANES], 1);
+        fe8_mul(&run, &run, &x);
+        acc[g] = run;
+    }
+
+    /* Invert the eight chain products with one inversion */
+    field_t tot[FIELD_IFMA_LANES], pre[FIELD_IFMA_LANES], inv;
+    fe8_store(tot, &run);
+    field_copy(&pre[0], &tot[0]);
+    for (int k = 1; k < FIELD_IFMA_LANES; k++) {
+        field_mul(&pre[k], &pre[k - 1], &tot[k]);
+    }
+    field_inv(&inv, &pre[FIELD_IFMA_LANES - 1]);
+    for (int k = FIELD_IFMA_LANES - 1; k > 0; k--) {
+        field_t t;
+        field_mul(&t, &inv, &pre[k - 1]);
+        field_mul(&inv, &inv, &tot[k]);
+        field_copy(&tot[k], &t);
+    }
+    field_copy(&tot[0], &inv);
+    fe8_load(&run, tot, 1);
+
+    /* Walk back: r_g = run·acc_{g-1}, then strip x_g from run */
+    for (size_t g = groups - 1; g > 0; g--) {
+        fe8_t y;
+        fe8_load(&x, &a[g * FIELD_IFMA_LANES], 1);
+        fe8_mul(&y, &run, &acc[g - 1]);
+        fe8_mul(&run, &run, &x);
+        fe8_store(&r[g * FIELD_IFMA_LANES], &y);
+    }
+    fe8_store(r, &run);
+
+    arena_restore(scratch, cp);
+    return true;
+}
+
+#else /* !TETSUO_HAVE_IFMA_KERNEL */
+
+bool field_ifma_available(void) {
+    return false;
+}
+
+void field_batch_mul_ifma(field_t *r, const field_t *a, const field_t *b, size_t count) {
+    (void)r; (void)a; (void)b; (void)count;
+}
+
+void field_batch_mul_soa52_ifma(uint64_t *r, const uint64_t *a, const uint64_t *b,
+                                size_t count, size_t stride) {
+    (void)r; (void)a; (void)b; (void)count; (void)stride;
+}
+
+bool field_batch_inv_ifma(field_t *r, const field_t *a, size_t count) {
+    (void)r; (void)a; (void)count;
+    return false;
+}
+
+#endif /* TETSUO_HAVE_IFMA_KERNEL */
@@ -0,0 +1,210 @@
+/*
+ * Eight-lane BN254 Fp arithmetic on AVX-512 IFMA
+ *
+ * Internal to the library. An element is five 52-bit limbs, one __m512i
+ * per limb (structure-of-arrays), so vpmadd52luq/vpmadd52huq produce the
+ * low and high halves of every 52x52-bit limb product directly. Kernels
+ * work in Montgomery form with R = 2^260 and convert at the edges:
+ *
+ *   mul(x·2^256, TO_R52)   = x·2^260      (field_t -> kernel)
+ *   mul(x·2^260, FROM_R52) = x·2^256      (kernel -> field_t)
+ *
+ * The helpers carry per-function target attributes, so callers compile
+ * without -mavx512ifma and must check field_ifma_available() first.
+ */
+
+#ifndef TETSUO_FIELD_IFMA_H
+#define TETSUO_FIELD_IFMA_H
+
+#include "field.h"
+#include "cpu.h"
+#include <stddef.h>
+#include <stdbool.h>
+
+/* Lanes per kernel call */
+#define FIELD_IFMA_LANES 8
+
+#ifdef TETSUO_X64_ASM
+#define TETSUO_HAVE_IFMA_KERNEL 1
+#endif
+
+/* True when the CPU runs AVX-512 IFMA and the kernels were compiled in */
+bool field_ifma_available(void);
+
+/*
+ * Kernels behind field_batch_mul, field_batch_mul_soa52 and
+ * field_batch_inv. Counts are multiples of FIELD_IFMA_LANES; the callers
+ * in field.c handle the tails.
+ */
+void field_batch_mul_ifma(field_t *r, const field_t *a, const field_t *b, size_t count);
+void field_batch_mul_soa52_ifma(uint64_t *r, const uint64_t *a, const uint64_t *b,
+                                size_t count, size_t stride);
+bool field_batch_inv_ifma(field_t *r, const field_t *a, size_t count);
+
+#ifdef TETSUO_HAVE_IFMA_KERNEL
+
+#include <immintrin.h>
+
+#define IFMA_FN static inline __attribute__((target("avx512f,avx512ifma")))
+
+#define LIMB52_MASK ((1ULL << 52) - 1)
+
+/* Limb loops must unroll so the limb arrays live in registers, even at -O2 */
+#define LIMB_LOOP _Pragma("GCC unroll 8")
+
+/* p, and -p^-1 mod 2^52 */
+static const uint64_t P_R52[5] =
+    {0x08c16d87cfd47ULL, 0x916871ca8d3c2ULL, 0x181585d97816aULL, 0xa029b85045b68ULL, 0x030644e72e131ULL};
+static const uint64_t P_INV_R52 = 0x20782e4866389ULL;
+
+/* Domain conversion multipliers: 2^264 mod p (in), 2^256 mod p (out) */
+static const uint64_t TO_R52[5] =
+    {0xb0f2afaec667aULL, 0xed9626b0fffbdULL, 0x9e2a0fcad825aULL, 0xe357276f48b70ULL, 0x00d791464ef86ULL};
+static const uint64_t FROM_R52[5] =
+    {0xd438dc58f0d9dULL, 0x28f5c70b3dd35ULL, 0x879462c0a78ebULL, 0xdf2f666ea36f7ULL, 0x00e0a77c19a07ULL};
+
+typedef struct {
+    __m512i l[5];
+} fe8_t;
+
+IFMA_FN __m512i bcast(uint64_t v) {
+    return _mm512_set1_epi64((long long)v);
+}
+
+IFMA_FN void fe8_const(fe8_t *r, const uint64_t c[5]) {
+    LIMB_LOOP
+    for (int j = 0; j < 5; j++) r->l[j] = bcast(c[j]);
+}
+
+IFMA_FN void fe8_zero(fe8_t *r) {
+    LIMB_LOOP
+    for (int j = 0; j < 5; j++) r->l[j] = _mm512_setzero_si512();
+}
+
+/* Carry-normalize t (value < 2p) and subtract p once if needed */
+IFMA_FN void fe8_reduce(fe8_t *r, __m512i t[5]) {
+    const __m512i mask = bcast(LIMB52_MASK);
+    const __m512i zero = _mm512_setzero_si512();
+
+    LIMB_LOOP
+    for (int j = 0; j < 4; j++) {
+        t[j + 1] = _mm512_add_epi64(t[j + 1], _mm512_srli_epi64(t[j], 52));
+        t[j] = _mm512_and_si512(t[j], mask);
+    }
+
+    __m512i s[5];
+    __m512i borrow = zero;
+    LIMB_LOOP
+    for (int j = 0; j < 5; j++) {
+        s[j] = _mm512_add_epi64(_mm512_sub_epi64(t[j], bcast(P_R52[j])), borrow);
+        borrow = _mm512_srai_epi64(s[j], 52);
+        s[j] = _mm512_and_si512(s[j], mask);
+    }
+
+    /* Final borrow set: t < p, keep t */
+    __mmask8 keep = _mm512_cmplt_epi64_mask(borrow, zero);
+    LIMB_LOOP
+    for (int j = 0; j < 5; j++) {
+        r->l[j] = _mm512_mask_blend_epi64(keep, s[j], t[j]);
+    }
+}
+
+IFMA_FN void fe8_add(fe8_t *r, const fe8_t *a, const fe8_t *b) {
+    __m512i t[5];
+    LIMB_LOOP
+    for (int j = 0; j < 5; j++) t[j] = _mm512_add_epi64(a->l[j], b->l[j]);
+    fe8_reduce(r, t);
+}
+
+/*
+ * Montgomery multiplication, operand scanning: each of the five rounds
+ * adds a_i·b, then m·p with m = t_0·(-p⁻¹) mod 2^52, and shifts one limb.
+ * Accumulators stay below 2^58, so the 64-bit lanes never overflow.
+ */
+IFMA_FN void fe8_mul(fe8_t *r, const fe8_t *a, const fe8_t *b) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i pinv = bcast(P_INV_R52);
+    __m512i p[5], t[6];
+
+    LIMB_LOOP
+    for (int j = 0; j < 5; j++) p[j] = bcast(P_R52[j]);
+    LIMB_LOOP
+    for (int j = 0; j < 6; j++) t[j] = zero;
+
+    LIMB_LOOP
+    for (int i = 0; i < 5; i++) {
+        __m512i ai = a->l[i];
+        LIMB_LOOP
+        for (int j = 0; j < 5; j++) {
+            t[j] = _mm512_madd52lo_epu64(t[j], ai, b->l[j]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], ai, b->l[j]);
+        }
+
+        __m512i m = _mm512_madd52lo_epu64(zero, t[0], pinv);
+        LIMB_LOOP
+        for (int j = 0; j < 5; j++) {
+            t[j] = _mm512_madd52lo_epu64(t[j], m, p[j]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], m, p[j]);
+        }
+
+        /* Low limb is now 0 mod 2^52: shift down one limb */
+        t[0] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], 52));
+        t[1] = t[2];
+        t[2] = t[3];
+        t[3] = t[4];
+        t[4] = t[5];
+        t[5] = zero;
+    }
+
+    fe8_reduce(r, t);
+}
+
+IFMA_FN void fe8_mul_const(fe8_t *r, const fe8_t *a, const uint64_t c[5]) {
+    fe8_t k;
+    fe8_const(&k, c);
+    fe8_mul(r, a, &k);
+}
+
+/* Eight field_t at stride `stride` -> SoA limbs, no domain change */
+IFMA_FN void fe8_gather(fe8_t *r, const field_t *in, size_t stride) {
+    _Alignas(64) uint64_t l[5][FIELD_IFMA_LANES];
+    for (int i = 0; i < FIELD_IFMA_LANES; i++) {
+        const uint64_t *x = in[(size_t)i * stride].limbs;
+        l[0][i] = x[0] & LIMB52_MASK;
+        l[1][i] = ((x[0] >> 52) | (x[1] << 12)) & LIMB52_MASK;
+        l[2][i] = ((x[1] >> 40) | (x[2] << 24)) & LIMB52_MASK;
+        l[3][i] = ((x[2] >> 28) | (x[3] << 36)) & LIMB52_MASK;
+        l[4][i] = x[3] >> 16;
+    }
+    for (int j = 0; j < 5; j++) r->l[j] = _mm512_load_si512(l[j]);
+}
+
+/* SoA limbs -> eight consecutive field_t, no domain change */
+IFMA_FN void fe8_scatter(field_t *out, const fe8_t *a) {
+    _Alignas(64) uint64_t l[5][FIELD_IFMA_LANES];
+    for (int j = 0; j < 5; j++) _mm512_store_si512(l[j], a->l[j]);
+    for (int i = 0; i < FIELD_IFMA_LANES; i++) {
+        out[i].limbs[0] = l[0][i] | (l[1][i] << 52);
+        out[i].limbs[1] = (l[1][i] >> 12) | (l[2][i] << 40);
+        out[i].limbs[2] = (l[2][i] >> 24) | (l[3][i] << 28);
+        out[i].limbs[3] = (l[3][i] >> 36) | (l[4][i] << 16);
+    }
+}
+
+/* Eight field_t at stride `stride`, R = 2^256 -> 2^260 */
+IFMA_FN void fe8_load(fe8_t *r, const field_t *in, size_t stride) {
+    fe8_t v;
+    fe8_gather(&v, in, stride);
+    fe8_mul_const(r, &v, TO_R52);
+}
+
+/* R = 2^260 -> eight consecutive field_t with R = 2^256 */
+IFMA_FN void fe8_store(field_t *out, const fe8_t *a) {
+    fe8_t v;
+    fe8_mul_const(&v, a, FROM_R52);
+    fe8_scatter(out, &v);
+}
+
+#endif /* TETSUO_HAVE_IFMA_KERNEL */
+
+#endif /* TETSUO_FIELD_IFMA_H */
@@ -0,0 +1,386 @@
+/*
+ * 256-bit Montgomery arithmetic backend (internal)
+ *
+ * Shared by the base field (field.c) and the scalar field (scalar.c).
+ * Every routine takes the modulus and -m⁻¹ mod 2⁶⁴ as arguments; callers
+ * pass compile-time constants so the inlined code is specialised per field.
+ * Moduli must be below 2²⁵⁴ (both BN254 fields are).
+ */
+
+#ifndef TETSUO_MONT_H
+#define TETSUO_MONT_H
+
+#include "cpu.h"
+#include <stdint.h>
+
+/*
+ * Two multiply/reduce kernels: _adx (MULX/ADCX/ADOX inline asm, x86-64
+ * only, run it only when cpu_features() has CPU_MULX_ADX) and _c
+ * (portable __uint128_t). The assembler takes MULX/ADX without -mbmi2
+ * or -madx, so both are always compiled in and field.c/scalar.c pick
+ * one at load time. Add/sub asm is baseline x86-64.
+ */
+
+#ifdef TETSUO_X64_ASM
+
+static inline uint64_t mont_add_256(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+    uint64_t carry;
+    __asm__ volatile (
+        "movq   (%[a]), %%rax\n\t"
+        "addq   (%[b]), %%rax\n\t"
+        "movq   %%rax, (%[r])\n\t"
+        "movq   8(%[a]), %%rax\n\t"
+        "adcq   8(%[b]), %%rax\n\t"
+        "movq   %%rax, 8(%[r])\n\t"
+        "movq   16(%[a]), %%rax\n\t"
+        "adcq   16(%[b]), %%rax\n\t"
+        "movq   %%rax, 16(%[r])\n\t"
+        "movq   24(%[a]), %%rax\n\t"
+        "adcq   24(%[b]), %%rax\n\t"
+        "movq   %%rax, 24(%[r])\n\t"
+        "setc   %%al\n\t"
+        "movzbq %%al, %[carry]"
+        : [carry] "=r" (carry)
+        : [r] "r" (r), [a] "r" (a), [b] "r" (b)
+        : "rax", "memory", "cc"
+    );
+    return carry;
+}
+
+static inline uint64_t mont_sub_256(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+    uint64_t borrow;
+    __asm__ volatile (
+        "movq   (%[a]), %%rax\n\t"
+        "subq   (%[b]), %%rax\n\t"
+        "movq   %%rax, (%[r])\n\t"
+        "movq   8(%[a]), %%rax\n\t"
+        "sbbq   8(%[b]), %%rax\n\t"
+        "movq   %%rax, 8(%[r])\n\t"
+        "movq   16(%[a]), %%rax\n\t"
+        "sbbq   16(%[b]), %%rax\n\t"
+        "movq   %%rax, 16(%[r])\n\t"
+        "movq   24(%[a]), %%rax\n\t"
+        "sbbq   24(%[b]), %%rax\n\t"
+        "movq   %%rax, 24(%[r])\n\t"
+        "setc   %%al\n\t"
+        "movzbq %%al, %[borrow]"
+        : [borrow] "=r" (borrow)
+        : [r] "r" (r), [a] "r" (a), [b] "r" (b)
+        : "rax", "memory", "cc"
+    );
+    return borrow;
+}
+
+/*
+ * t[0..7] -> t·2⁻²⁵⁶ mod m in r[0..3].
+ * Each round adds k·m at limb i using two carry chains: adcx for the low
+ * product halves, adox for the high halves.
+ */
+static inline void mont_reduce_adx(uint64_t *r, uint64_t *t, const uint64_t *m, uint64_t inv) {
+    uint64_t tmp[4];
+
+    for (int i = 0; i < 4; i++) {
+        uint64_t k = t[i] * inv;
+        uint64_t carry;
+
+        __asm__ (
+            "xorl   %%eax, %%eax\n\t"
+            "movq   %[k], %%rdx\n\t"
+            "mulxq  %[m0], %%rax, %%rcx\n\t"
+            "adcxq  %%rax, %[t0]\n\t"
+            "adoxq  %%rcx, %[t1]\n\t"
+            "mulxq  %[m1], %%rax, %%rcx\n\t"
+            "adcxq  %%rax, %[t1]\n\t"
+            "adoxq  %%rcx, %[t2]\n\t"
+            "mulxq  %[m2], %%rax, %%rcx\n\t"
+            "adcxq  %%rax, %[t2]\n\t"
+            "adoxq  %%rcx, %[t3]\n\t"
+            "mulxq  %[m3], %%rax, %%rcx\n\t"
+            "adcxq  %%rax, %[t3]\n\t"
+            "adoxq  %%rcx, %[t4]\n\t"
+            "movl   $0, %%eax\n\t"
+            "adcxq  %%rax, %[t4]\n\t"
+            "movl   $0, %k[c]\n\t"
+            "adcxq  %%rax, %[c]\n\t"
+            "adoxq  %%rax, %[c]"
+            : [t0] "+r" (t[i]), [t1] "+r" (t[i+1]), [t2] "+r" (t[i+2]),
+              [t3] "+r" (t[i+3]), [t4] "+r" (t[i+4]), [c] "=&r" (carry)
+            : [k] "r" (k),
+              [m0] "m" (m[0]), [m1] "m" (m[1]),
+              [m2] "m" (m[2]), [m3] "m" (m[3])
+            : "rax", "rcx", "rdx", "cc"
+        );
+
+        for (int j = i + 5; j < 8 && carry; j++) {
+            t[j] += carry;
+            carry = t[j] < carry;
+        }
+    }
+
+    r[0] = t[4]; r[1] = t[5]; r[2] = t[6]; r[3] = t[7];
+
+    uint64_t borrow = mont_sub_256(tmp, r, m);
+    /* If no borrow (borrow=0), r >= m, use tmp. If borrow (borrow=1), r < m, keep r */
+    uint64_t mask = borrow - 1;  /* 0 if borrow, all 1s if no borrow */
+    r[0] = (r[0] & ~mask) | (tmp[0] & mask);
+    r[1] = (r[1] & ~mask) | (tmp[1] & mask);
+    r[2] = (r[2] & ~mask) | (tmp[2] & mask);
+    r[3] = (r[3] & ~mask) | (tmp[3] & mask);
+}
+
+/*
+ * Schoolbook 4x4 product. Row 0 is a single carry chain; rows 1-3
+ * accumulate with adcx (low halves) and adox (high halves).
+ */
+static inline void mont_mul_256x256_adx(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+    uint64_t t0, t1, t2, t3, t4, t5, t6, t7;
+    uint64_t c0, c1;
+
+    __asm__ (
+        "movq   (%[a]), %%rdx\n\t"
+        "mulxq  (%[b]), %[t0], %[c0]\n\t"
+        "mulxq  8(%[b]), %[t1], %[c1]\n\t"
+        "addq   %[c0], %[t1]\n\t"
+        "mulxq  16(%[b]), %[t2], %[c0]\n\t"
+        "adcq   %[c1], %[t2]\n\t"
+        "mulxq  24(%[b]), %[t3], %[t4]\n\t"
+        "adcq   %[c0], %[t3]\n\t"
+        "adcq   $0, %[t4]\n\t"
+
+        "movq   8(%[a]), %%rdx\n\t"
+        "xorq   %[t5], %[t5]\n\t"
+        "mulxq  (%[b]), %[c0], %[c1]\n\t"
+        "adcxq  %[c0], %[t1]\n\t"
+        "adoxq  %[c1], %[t2]\n\t"
+        "mulxq  8(%[b]), %[c0], %[c1]\n\t"
+        "adcxq  %[c0], %[t2]\n\t"
+        "adoxq  %[c1], %[t3]\n\t"
+        "mulxq  16(%[b]), %[c0], %[c1]\n\t"
+        "adcxq  %[c0], %[t3]\n\t"
+        "adoxq  %[c1], %[t4]\n\t"
+        "mulxq  24(%[b]), %[c0], %[c1]\n\t"
+        "adcxq  %[c0], %[t4]\n\t"
+        "adoxq  %[c1], %[t5]\n\t"
+        "movq   $0, %[c0]\n\t"
+        "adcxq  %[c0], %[t5]\n\t"
+
+        "movq   16(%[a]), %%rdx\n\t"
+        "xorq   %[t6], %[t6]\n\t"
+        "mulxq  (%[b]), %[c0], %[c1]\n\t"
+        "adcxq  %[c0], %[t2]\n\t"
+        "adoxq  %[c1], %[t3]\n\t"
+        "mulxq  8(%[b]), %[c0], %[c1]\n\t"
+        "adcxq  %[c0], %[t3]\n\t"
+        "adoxq  %[c1], %[t4]\n\t"
+        "mulxq  16(%[b]), %[c0], %[c1]\n\t"
+        "adcxq  %[c0], %[t4]\n\t"
+        "adoxq  %[c1], %[t5]\n\t"
+        "mulxq  24(%[b]), %[c0], %[c1]\n\t"
+        "adcxq  %[c0], %[t5]\n\t"
+        "adoxq  %[c1], %[t6]\n\t"
+        "movq   $0, %[c0]\n\t"
+        "adcxq  %[c0], %[t6]\n\t"
+
+        "movq   24(%[a]), %%rdx\n\t"
+        "xorq   %[t7], %[t7]\n\t"
+        "mulxq  (%[b]), %[c0], %[c1]\n\t"
+        "adcxq  %[c0], %[t3]\n\t"
+        "adoxq  %[c1], %[t4]\n\t"
+        "mulxq  8(%[b]), %[c0], %[c1]\n\t"
+        "adcxq  %[c0], %[t4]\n\t"
+        "adoxq  %[c1], %[t5]\n\t"
+        "mulxq  16(%[b]), %[c0], %[c1]\n\t"
+        "adcxq  %[c0], %[t5]\n\t"
+        "adoxq  %[c1], %[t6]\n\t"
+        "mulxq  24(%[b]), %[c0], %[c1]\n\t"
+        "adcxq  %[c0], %[t6]\n\t"
+        "adoxq  %[c1], %[t7]\n\t"
+        "movq   $0, %[c0]\n\t"
+        "adcxq  %[c0], %[t7]"
+
+        : [t0] "=&r" (t0), [t1] "=&r" (t1), [t2] "=&r" (t2), [t3] "=&r" (t3),
+          [t4] "=&r" (t4), [t5] "=&r" (t5), [t6] "=&r" (t6), [t7] "=&r" (t7),
+          [c0] "=&r" (c0), [c1] "=&r" (c1)
+        : [a] "r" (a), [b] "r" (b)
+        : "rdx", "cc", "memory"
+    );
+
+    r[0] = t0; r[1] = t1; r[2] = t2; r[3] = t3;
+    r[4] = t4; r[5] = t5; r[6] = t6; r[7] = t7;
+}
+
+/* Cross products once, doubled, then the diagonal a[i]² added in */
+static inline void mont_sqr_256_adx(uint64_t *r, const uint64_t *a) {
+    uint64_t t1, t2, t3, t4, t5, t6, t7;
+    uint64_t c0, c1;
+
+    __asm__ (
+        /* a0·(a1, a2, a3) -> t1..t4 */
+        "movq   (%[a]), %%rdx\n\t"
+        "mulxq  8(%[a]), %[t1], %[t2]\n\t"
+        "mulxq  16(%[a]), %[c0], %[t3]\n\t"
+        "addq   %[c0], %[t2]\n\t"
+        "mulxq  24(%[a]), %[c0], %[t4]\n\t"
+        "adcq   %[c0], %[t3]\n\t"
+        "adcq   $0, %[t4]\n\t"
+
+        /* a1·(a2, a3) -> t3..t5 */
+        "movq   8(%[a]), %%rdx\n\t"
+        "xorq   %[t5], %[t5]\n\t"
+        "mulxq  16(%[a]), %[c0], %[c1]\n\t"
+        "adcxq  %[c0], %[t3]\n\t"
+        "adoxq  %[c1], %[t4]\n\t"
+        "mulxq  24(%[a]), %[c0], %[c1]\n\t"
+        "adcxq  %[c0], %[t4]\n\t"
+        "adoxq  %[c1], %[t5]\n\t"
+        "movq   $0, %[c0]\n\t"
+        "adcxq  %[c0], %[t5]\n\t"
+
+        /* a2·a3 -> t5..t6 */
+        "movq   16(%[a]), %%rdx\n\t"
+        "mulxq  24(%[a]), %[c0], %[t6]\n\t"
+        "addq   %[c0], %[t5]\n\t"
+        "adcq   $0, %[t6]\n\t"
+
+        /* Double the cross products */
+        "xorq   %[t7], %[t7]\n\t"
+        "addq   %[t1], %[t1]\n\t"
+        "adcq   %[t2], %[t2]\n\t"
+        "adcq   %[t3], %[t3]\n\t"
+        "adcq   %[t4], %[t4]\n\t"
+        "adcq   %[t5], %[t5]\n\t"
+        "adcq   %[t6], %[t6]\n\t"
+        "adcq   $0, %[t7]\n\t"
+
+        /* Add the diagonal */
+        "movq   (%[a]), %%rdx\n\t"
+        "mulxq  %%rdx, %%rdx, %[c1]\n\t"
+        "movq   %%rdx, (%[r])\n\t"
+        "addq   %[c1], %[t1]\n\t"
+        "movq   8(%[a]), %%rdx\n\t"
+        "mulxq  %%rdx, %[c0], %[c1]\n\t"
+        "adcq   %[c0], %[t2]\n\t"
+        "adcq   %[c1], %[t3]\n\t"
+        "movq   16(%[a]), %%rdx\n\t"
+        "mulxq  %%rdx, %[c0], %[c1]\n\t"
+        "adcq   %[c0], %[t4]\n\t"
+        "adcq   %[c1], %[t5]\n\t"
+        "movq   24(%[a]), %%rdx\n\t"
+        "mulxq  %%rdx, %[c0], %[c1]\n\t"
+        "adcq   %[c0], %[t6]\n\t"
+        "adcq   %[c1], %[t7]"
+
+        : [t1] "=&r" (t1), [t2] "=&r" (t2), [t3] "=&r" (t3),
+          [t4] "=&r" (t4), [t5] "=&r" (t5), [t6] "=&r" (t6), [t7] "=&r" (t7),
+          [c0] "=&r" (c0), [c1] "=&r" (c1)
+        : [a] "r" (a), [r] "r" (r)
+        : "rdx", "cc", "memory"
+    );
+
+    r[1] = t1; r[2] = t2; r[3] = t3;
+    r[4] = t4; r[5] = t5; r[6] = t6; r[7] = t7;
+}
+
+#else
+
+static inline uint64_t mont_add_256(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+    __uint128_t acc = 0;
+    for (int i = 0; i < 4; i++) {
+        acc += (__uint128_t)a[i] + b[i];
+        r[i] = (uint64_t)acc;
+        acc >>= 64;
+    }
+    return (uint64_t)acc;
+}
+
+static inline uint64_t mont_sub_256(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+    __int128_t acc = 0;
+    for (int i = 0; i < 4; i++) {
+        acc += (__int128_t)a[i] - b[i];
+        r[i] = (uint64_t)acc;
+        acc >>= 64;
+    }
+    return (acc < 0) ? 1 : 0;
+}
+
+#endif
+
+static inline void mont_mul_256x256_c(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+    __uint128_t acc;
+    uint64_t carry = 0;
+
+    for (int i = 0; i < 8; i++) r[i] = 0;
+
+    for (int i = 0; i < 4; i++) {
+        carry = 0;
+        for (int j = 0; j < 4; j++) {
+            acc = (__uint128_t)a[i] * b[j] + r[i + j] + carry;
+            r[i + j] = (uint64_t)acc;
+            carry = (uint64_t)(acc >> 64);
+        }
+        r[i + 4] = carry;
+    }
+}
+
+static inline void mont_sqr_256_c(uint64_t *r, const uint64_t *a) {
+    mont_mul_256x256_c(r, a, a);
+}
+
+static inline void mont_reduce_c(uint64_t *r, uint64_t *t, const uint64_t *m, uint64_t inv) {
+    __uint128_t acc;
+    uint64_t k, carry;
+
+    for (int i = 0; i < 4; i++) {
+        k = t[i] * inv;
+        carry = 0;
+        for (int j = 0; j < 4; j++) {
+            acc = (__uint128_t)k * m[j] + t[i + j] + carry;
+            t[i + j] = (uint64_t)acc;
+            carry = (uint64_t)(acc >> 64);
+        }
+        for (int j = i + 4; j < 8 && carry; j++) {
+            acc = (__uint128_t)t[j] + carry;
+            t[j] = (uint64_t)acc;
+            carry = (uint64_t)(acc >> 64);
+        }
+    }
+
+    r[0] = t[4]; r[1] = t[5]; r[2] = t[6]; r[3] = t[7];
+
+    uint64_t tmp[4];
+    uint64_t borrow = mont_sub_256(tmp, r, m);
+    uint64_t mask = borrow - 1;
+    r[0] = (r[0] & ~mask) | (tmp[0] & mask);
+    r[1] = (r[1] & ~mask) | (tmp[1] & mask);
+    r[2] = (r[2] & ~mask) | (tmp[2] & mask);
+    r[3] = (r[3] & ~mask) | (tmp[3] & mask);
+}
+
+/* Constant-time modular add/sub on reduced inputs */
+static inline void mont_add_mod(uint64_t *r, const uint64_t *a, const uint64_t *b,
+                                const uint64_t *m) {
+    uint64_t tmp[4];
+    uint64_t carry = mont_add_256(r, a, b);
+    uint64_t borrow = mont_sub_256(tmp, r, m);
+    /* carry=1 means definitely >= m, borrow=0 means r >= m */
+    uint64_t use_reduced = carry | (borrow ^ 1);
+    uint64_t mask = -(uint64_t)use_reduced;
+    r[0] = (r[0] & ~mask) | (tmp[0] & mask);
+    r[1] = (r[1] & ~mask) | (tmp[1] & mask);
+    r[2] = (r[2] & ~mask) | (tmp[2] & mask);
+    r[3] = (r[3] & ~mask) | (tmp[3] & mask);
+}
+
+static inline void mont_sub_mod(uint64_t *r, const uint64_t *a, const uint64_t *b,
+                                const uint64_t *m) {
+    uint64_t tmp[4];
+    uint64_t borrow = mont_sub_256(r, a, b);
+    mont_add_256(tmp, r, m);
+    uint64_t mask = -(uint64_t)borrow;
+    r[0] = (r[0] & ~mask) | (tmp[0] & mask);
+    r[1] = (r[1] & ~mask) | (tmp[1] & mask);
+    r[2] = (r[2] & ~mask) | (tmp[2] & mask);
+    r[3] = (r[3] & ~mask) | (tmp[3] & mask);
+}
+
+#endif /* TETSUO_MONT_H */
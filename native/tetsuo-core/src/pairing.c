@@ -7,19 +7,28 @@
 
 #include "pairing.h"
 #include "field.h"
+#include "scalar.h"
 #include "arena.h"
+#include "verify.h"
+#include "rng.h"
+#include "sha256.h"
 #include <string.h>
 #include <stdlib.h>
 #include <stdatomic.h>
 
-#ifdef _WIN32
-#include <windows.h>
-#include <bcrypt.h>
-#pragma comment(lib, "bcrypt.lib")
-#else
-#include <fcntl.h>
-#include <unistd.h>
-#endif
+/*
+ * Native G1 helpers (shared by both builds)
+ */
+
+static void g1_to_point(point_t *out, const g1_t *in) {
+    if (in->is_infinity) {
+        point_set_infinity(out);
+        return;
+    }
+    field_copy(&out->x, &in->x);
+    field_copy(&out->y, &in->y);
+    field_set_one(&out->z);
+}
 
 #ifdef TETSUO_USE_MCL
 
@@ -35,6 +44,24 @@ typedef mclBnG2 mcl_g2_t;
 typedef mclBnGT mcl_gt_t;
 typedef mclBnFr mcl_fr_t;
 
+/*
+ * Zero-copy bridge to mcl.
+ *
+ * mcl keeps BN254 Fp elements in Montgomery form with R = 2^256, which is
+ * exactly our field_t layout. Points map limb-for-limb: affine (x, y)
+ * becomes Jacobian (x, y, 1) and Fp2 is (re, im). pairing_init verifies the
+ * representations agree before any of this is used.
+ */
+_Static_assert(sizeof(mclBnFp) == sizeof(field_t), "mclBnFp must match field_t");
+
+static inline void fp_to_mcl(mclBnFp *out, const field_t *in) {
+    memcpy(out->d, in->limbs, sizeof(out->d));
+}
+
+static inline void fp_from_mcl(field_t *out, const mclBnFp *in) {
+    memcpy(out->limbs, in->d, sizeof(out->limbs));
+}
+
 /* Thread-safe initialization flag */
 static atomic_bool g_pairing_initialized = false;
 
@@ -53,6 +80,48 @@ bool pairing_init(void) {
         return false;
     }
 
+    /* The zero-copy bridge needs mcl's Fp one to be our Montgomery R */
+    mclBnFp mcl_one;
+    field_t one;
+    mclBnFp_setInt32(&mcl_one, 1);
+    field_set_one(&one);
+    if (memcmp(mcl_one.d, one.limbs, sizeof(one.limbs)) != 0) {
+        atomic_store(&g_pairing_initialized, false);
+        return false;
+    }
+
+    /*
+     * point_t hands Jacobian (X, Y, Z) straight to mcl; check mcl reads it
+     * as x = X/Z², y = Y/Z³ using G1 = (1, 2) scaled by Z = 2.
+     */
+    mcl_g1_t g_affine, g_jac;
+    field_t c;
+    field_set_one(&c);
+    fp_to_mcl(&g_affine.x, &c);
+    fp_to_mcl(&g_affine.z, &c);
+    field_add(&c, &c, &c);
+    fp_to_mcl(&g_affine.y, &c);     /* y = 2 */
+    fp_to_mcl(&g_jac.z, &c);        /* Z = 2 */
+    field_add(&c, &c, &c);
+    fp_to_mcl(&g_jac.x, &c);        /* X = 1·2² */
+    field_add(&c, &c, &c);
+    field_add(&c, &c, &c);
+    fp_to_mcl(&g_jac.y, &c);        /* Y = 2·2³ */
+    if (!mclBnG1_isEqual(&g_affine, &g_jac)) {
+        atomic_store(&g_pairing_initialized, false);
+        return false;
+    }
+
+    /* Likewise for Fr and scalar_t */
+    mcl_fr_t mcl_fr_one;
+    scalar_t fr_one;
+    mclBnFr_setInt32(&mcl_fr_one, 1);
+    fr_set_one(&fr_one);
+    if (memcmp(mcl_fr_one.d, fr_one.limbs, sizeof(fr_one.limbs)) != 0) {
+        atomic_store(&g_pairing_initialized, false);
+        return false;
+    }
+
     return true;
 }
 
@@ -64,36 +133,19 @@ bool pairing_is_initialized(void) {
     return atomic_load(&g_pairing_initialized);
 }
 
-/* Convert our G1 point to mcl's serialization format */
 static void g1_to_mcl(mcl_g1_t *out, const g1_t *in) {
     if (in->is_infinity) {
         mclBnG1_clear(out);
         return;
     }
 
-    uint8_t buf[64];
-
-    /* Convert from Montgomery to standard form and serialize */
-    field_t x_std, y_std;
-    field_from_mont(&x_std, &in->x);
-    field_from_mont(&y_std, &in->y);
-
-    /* Serialize to big-endian bytes (BN254 standard format) */
-    field_to_bytes(buf, &x_std);
-    field_to_bytes(buf + 32, &y_std);
-
-    /* Use binary deserialize - mcl expects uncompressed format */
-    if (mclBnG1_deserialize(out, buf, 64) == 0) {
-        /* Fallback: try setting coordinates directly */
-        mclBnFp x_fp, y_fp;
-        mclBnFp_setLittleEndian(&x_fp, x_std.limbs, 32);
-        mclBnFp_setLittleEndian(&y_fp, y_std.limbs, 32);
-        /* Set point from coordinates */
-        mclBnG1_clear(out);
-    }
+    field_t one;
+    field_set_one(&one);
+    fp_to_mcl(&out->x, &in->x);
+    fp_to_mcl(&out->y, &in->y);
+    fp_to_mcl(&out->z, &one);
 }
 
-/* Convert mcl to our g1_t format */
 static void g1_from_mcl(g1_t *out, const mcl_g1_t *in) {
     if (mclBnG1_isZero(in)) {
         out->is_infinity = true;
@@ -102,49 +154,86 @@ static void g1_from_mcl(g1_t *out, const mcl_g1_t *in) {
         return;
     }
 
-    out->is_infinity = false;
+    /* Jacobian -> affine (no-op when z is already one) */
+    mcl_g1_t n;
+    mclBnG1_normalize(&n, in);
 
-    /* Serialize from mcl to bytes */
-    uint8_t buf[64];
-    size_t n = mclBnG1_serialize(buf, sizeof(buf), in);
-    if (n == 0) {
-        out->is_infinity = true;
-        return;
-    }
+    out->is_infinity = false;
+    fp_from_mcl(&out->x, &n.x);
+    fp_from_mcl(&out->y, &n.y);
+}
 
-    /* Deserialize bytes to field elements and convert to Montgomery */
-    field_from_bytes(&out->x, buf);
-    field_from_bytes(&out->y, buf + 32);
-    field_to_mont(&out->x, &out->x);
-    field_to_mont(&out->y, &out->y);
+/* Native Jacobian point: same coordinates mcl uses, infinity is Z = 0 */
+static inline void point_to_mcl(mcl_g1_t *out, const point_t *in) {
+    fp_to_mcl(&out->x, &in->x);
+    fp_to_mcl(&out->y, &in->y);
+    fp_to_mcl(&out->z, &in->z);
 }
 
-/* Convert our G2 point to mcl format. Fp2 coords: x_im || x_re || y_im || y_re */
 static void g2_to_mcl(mcl_g2_t *out, const g2_t *in) {
     if (in->is_infinity) {
         mclBnG2_clear(out);
         return;
     }
 
-    uint8_t buf[128];
-    field_t tmp;
+    field_t one, zero;
+    field_set_one(&one);
+    field_set_zero(&zero);
+    fp_to_mcl(&out->x.d[0], &in->x_re);
+    fp_to_mcl(&out->x.d[1], &in->x_im);
+    fp_to_mcl(&out->y.d[0], &in->y_re);
+    fp_to_mcl(&out->y.d[1], &in->y_im);
+    fp_to_mcl(&out->z.d[0], &one);
+    fp_to_mcl(&out->z.d[1], &zero);
+}
+
+static void g2_from_mcl(g2_t *out, const mcl_g2_t *in) {
+    if (mclBnG2_isZero(in)) {
+        memset(out, 0, sizeof(*out));
+        out->is_infinity = true;
+        return;
+    }
+
+    mcl_g2_t n;
+    mclBnG2_normalize(&n, in);
 
-    /* x = x_re + i*x_im -> serialize as (x_im, x_re) */
-    field_from_mont(&tmp, &in->x_im);
-    field_to_bytes(buf, &tmp);
-    field_from_mont(&tmp, &in->x_re);
-    field_to_bytes(buf + 32, &tmp);
+    out->is_infinity = false;
+    fp_from_mcl(&out->x_re, &n.x.d[0]);
+    fp_from_mcl(&out->x_im, &n.x.d[1]);
+    fp_from_mcl(&out->y_re, &n.y.d[0]);
+    fp_from_mcl(&out->y_im, &n.y.d[1]);
+}
 
-    /* y = y_re + i*y_im -> serialize as (y_im, y_re) */
-    field_from_mont(&tmp, &in->y_im);
-    field_to_bytes(buf + 64, &tmp);
-    field_from_mont(&tmp, &in->y_re);
-    field_to_bytes(buf + 96, &tmp);
+/*
+ * gt_t has mcl's Fp12 layout, so GT values are handed to mcl in place.
+ * mcl is a separately compiled library; no aliasing is visible to us.
+ */
+_Static_assert(sizeof(mclBnGT) == sizeof(gt_t), "mclBnGT must match gt_t");
 
-    if (mclBnG2_deserialize(out, buf, 128) == 0) {
-        /* Deserialization failed, clear output */
-        mclBnG2_clear(out);
-    }
+static inline mcl_gt_t *gt_as_mcl(gt_t *a) {
+    return (mcl_gt_t *)(void *)a;
+}
+
+static inline const mcl_gt_t *gt_as_mcl_const(const gt_t *a) {
+    return (const mcl_gt_t *)(const void *)a;
+}
+
+/* scalar_t is mcl's Fr layout (Montgomery, R = 2^256 mod r) */
+_Static_assert(sizeof(mcl_fr_t) == sizeof(scalar_t), "mclBnFr must match scalar_t");
+
+static inline const mcl_fr_t *fr_as_mcl_const(const scalar_t *a) {
+    return (const mcl_fr_t *)(const void *)a;
+}
+
+/*
+ * Fp element (Montgomery form) -> Fr scalar.
+ * Takes the canonical integer value and reduces it mod r, so public inputs
+ * act on IC points as the integers the circuit sees.
+ */
+static void scalar_to_mcl(mcl_fr_t *out, const field_t *s) {
+    scalar_t fr;
+    fr_from_field(&fr, s);
+    memcpy(out->d, fr.limbs, sizeof(out->d));
 }
 
 bool pairing_compute(gt_t *result, const g1_t *p, const g2_t *q) {
@@ -152,15 +241,11 @@ bool pairing_compute(gt_t *result, const g1_t *p, const g2_t *q) {
 
     mcl_g1_t mcl_p;
     mcl_g2_t mcl_q;
-    mcl_gt_t mcl_result;
 
     g1_to_mcl(&mcl_p, p);
     g2_to_mcl(&mcl_q, q);
 
-    mclBn_pairing(&mcl_result, &mcl_p, &mcl_q);
-
-    /* Copy result to our format */
-    mclBnGT_serialize(result->data, sizeof(result->data), &mcl_result);
+    mclBn_pairing(gt_as_mcl(result), &mcl_p, &mcl_q);
 
     return true;
 }
@@ -185,35 +270,33 @@ bool pairing_multi(gt_t *result, const g1_t *ps, const g2_t *qs, size_t n) {
         g2_to_mcl(&mcl_qs[i], &qs[i]);
     }
 
-    mcl_gt_t mcl_result;
-    mclBn_millerLoopVec(&mcl_result, mcl_ps, mcl_qs, n);
-    mclBn_finalExp(&mcl_result, &mcl_result);
-
-    mclBnGT_serialize(result->data, sizeof(result->data), &mcl_result);
+    mclBn_millerLoopVec(gt_as_mcl(result), mcl_ps, mcl_qs, n);
+    mclBn_finalExp(gt_as_mcl(result), gt_as_mcl(result));
 
     arena_restore(scratch, cp);
     return true;
 }
 
 void gt_mul(gt_t *r, const gt_t *a, const gt_t *b) {
-    mcl_gt_t mcl_a, mcl_b, mcl_r;
-    mclBnGT_deserialize(&mcl_a, a->data, sizeof(a->data));
-    mclBnGT_deserialize(&mcl_b, b->data, sizeof(b->data));
-    mclBnGT_mul(&mcl_r, &mcl_a, &mcl_b);
-    mclBnGT_serialize(r->data, sizeof(r->data), &mcl_r);
+    mclBnGT_mul(gt_as_mcl(r), gt_as_mcl_const(a), gt_as_mcl_const(b));
 }
 
 bool gt_is_one(const gt_t *a) {
-    mcl_gt_t mcl_a;
-    mclBnGT_deserialize(&mcl_a, a->data, sizeof(a->data));
-    return mclBnGT_isOne(&mcl_a) != 0;
+    return mclBnGT_isOne(gt_as_mcl_const(a)) != 0;
 }
 
 bool gt_eq(const gt_t *a, const gt_t *b) {
-    mcl_gt_t mcl_a, mcl_b;
-    mclBnGT_deserialize(&mcl_a, a->data, sizeof(a->data));
-    mclBnGT_deserialize(&mcl_b, b->data, sizeof(b->data));
-    return mclBnGT_isEqual(&mcl_a, &mcl_b) != 0;
+    return mclBnGT_isEqual(gt_as_mcl_const(a), gt_as_mcl_const(b)) != 0;
+}
+
+size_t gt_serialize(uint8_t *out, size_t max_len, const gt_t *a) {
+    if (max_len < GT_SERIALIZED_SIZE) return 0;
+    return mclBnGT_serialize(out, max_len, gt_as_mcl_const(a));
+}
+
+bool gt_deserialize(gt_t *r, const uint8_t *data, size_t len) {
+    if (len < GT_SERIALIZED_SIZE) return false;
+    return mclBnGT_deserialize(gt_as_mcl(r), data, len) != 0;
 }
 
 void g1_set_infinity(g1_t *p) {
@@ -225,22 +308,6 @@ bool g1_is_infinity(const g1_t *p) {
     return p->is_infinity;
 }
 
-bool g1_is_on_curve(const g1_t *p) {
-    if (p->is_infinity) return true;
-
-    mcl_g1_t mcl_p;
-    g1_to_mcl(&mcl_p, p);
-    return mclBnG1_isValid(&mcl_p) != 0;
-}
-
-bool g1_is_in_subgroup(const g1_t *p) {
-    if (p->is_infinity) return true;
-
-    mcl_g1_t mcl_p;
-    g1_to_mcl(&mcl_p, p);
-    return mclBnG1_isValidOrder(&mcl_p) != 0;
-}
-
 void g1_add(g1_t *r, const g1_t *a, const g1_t *b) {
     mcl_g1_t mcl_a, mcl_b, mcl_r;
     g1_to_mcl(&mcl_a, a);
@@ -254,7 +321,7 @@ void g1_scalar_mul(g1_t *r, const g1_t *p, const field_t *scalar) {
     mcl_fr_t mcl_s;
 
     g1_to_mcl(&mcl_p, p);
-    mclBnFr_setLittleEndian(&mcl_s, (const char *)scalar->limbs, 32);
+    scalar_to_mcl(&mcl_s, scalar);
     mclBnG1_mul(&mcl_r, &mcl_p, &mcl_s);
     g1_from_mcl(r, &mcl_r);
 }
@@ -284,78 +351,6 @@ void g1_to_bytes(uint8_t *out, const g1_t *p) {
     mclBnG1_serialize(out, 64, &mcl_p);
 }
 
-void g2_set_infinity(g2_t *p) {
-    memset(p, 0, sizeof(*p));
-    p->is_infinity = true;
-}
-
-bool g2_is_infinity(const g2_t *p) {
-    return p->is_infinity;
-}
-
-bool g2_is_on_curve(const g2_t *p) {
-    if (p->is_infinity) return true;
-
-    mcl_g2_t mcl_p;
-    g2_to_mcl(&mcl_p, p);
-    return mclBnG2_isValid(&mcl_p) != 0;
-}
-
-bool g2_is_in_subgroup(const g2_t *p) {
-    if (p->is_infinity) return true;
-
-    mcl_g2_t mcl_p;
-    g2_to_mcl(&mcl_p, p);
-    return mclBnG2_isValidOrder(&mcl_p) != 0;
-}
-
-/* Convert mcl to our g2_t format */
-static void g2_from_mcl(g2_t *out, const mcl_g2_t *in) {
-    if (mclBnG2_isZero(in)) {
-        g2_set_infinity(out);
-        return;
-    }
-
-    out->is_infinity = false;
-
-    /* Serialize from mcl to bytes */
-    uint8_t buf[128];
-    size_t n = mclBnG2_serialize(buf, sizeof(buf), in);
-    if (n == 0) {
-        g2_set_infinity(out);
-        return;
-    }
-
-    /*
-     * mcl serialization format: x_im || x_re || y_im || y_re (each 32 bytes)
-     * Deserialize bytes to field elements and convert to Montgomery.
-     */
-    field_from_bytes(&out->x_im, buf);
-    field_from_bytes(&out->x_re, buf + 32);
-    field_from_bytes(&out->y_im, buf + 64);
-    field_from_bytes(&out->y_re, buf + 96);
-
-    field_to_mont(&out->x_im, &out->x_im);
-    field_to_mont(&out->x_re, &out->x_re);
-    field_to_mont(&out->y_im, &out->y_im);
-    field_to_mont(&out->y_re, &out->y_re);
-}
-
-void g2_add(g2_t *r, const g2_t *a, const g2_t *b) {
-    mcl_g2_t mcl_a, mcl_b, mcl_r;
-    g2_to_mcl(&mcl_a, a);
-    g2_to_mcl(&mcl_b, b);
-    mclBnG2_add(&mcl_r, &mcl_a, &mcl_b);
-    g2_from_mcl(r, &mcl_r);
-}
-
-void g2_neg(g2_t *r, const g2_t *p) {
-    mcl_g2_t mcl_p, mcl_r;
-    g2_to_mcl(&mcl_p, p);
-    mclBnG2_neg(&mcl_r, &mcl_p);
-    g2_from_mcl(r, &mcl_r);
-}
-
 bool g2_from_bytes(g2_t *p, const uint8_t *data, size_t len) {
     if (len < 128) return false;
 
@@ -380,6 +375,10 @@ bool vk_load(groth16_vk_t *vk, const uint8_t *data, size_t len) {
     size_t min_len = 64 + 128 + 128 + 128 + 4;
     if (len < min_len) return false;
 
+    vk->beta_lines = NULL;
+    vk->neg_gamma_lines = NULL;
+    vk->neg_delta_lines = NULL;
+
     size_t offset = 0;
 
     if (!g1_from_bytes(&vk->alpha, data + offset, 64)) return false;
@@ -417,8 +416,58 @@ bool vk_load(groth16_vk_t *vk, const uint8_t *data, size_t len) {
         offset += 64;
     }
 
-    /* Precompute e(alpha, beta) */
-    pairing_compute(&vk->alpha_beta, &vk->alpha, &vk->beta);
+    if (!vk_prepare(vk)) {
+        vk_free(vk);
+        return false;
+    }
+
+    return true;
+}
+
+static void vk_free_lines(groth16_vk_t *vk) {
+    /* All three line buffers share one allocation rooted at beta_lines */
+    free(vk->beta_lines);
+    vk->beta_lines = NULL;
+    vk->neg_gamma_lines = NULL;
+    vk->neg_delta_lines = NULL;
+}
+
+bool vk_prepare(groth16_vk_t *vk) {
+    if (!g_pairing_initialized) return false;
+
+    /* Build into fresh storage; the key is only touched once all of it succeeds */
+    gt_t alpha_beta;
+    if (!pairing_compute(&alpha_beta, &vk->alpha, &vk->beta)) {
+        return false;
+    }
+
+    int n = mclBn_getUint64NumToPrecompute();
+    if (n <= 0) return false;
+
+    uint64_t *lines = malloc(3 * (size_t)n * sizeof(uint64_t));
+    if (!lines) return false;
+
+    mcl_g2_t q;
+
+    g2_to_mcl(&q, &vk->beta);
+    mclBn_precomputeG2(lines, &q);
+
+    /* Negate once here so verification never negates its G1 inputs */
+    g2_to_mcl(&q, &vk->gamma);
+    mclBnG2_neg(&q, &q);
+    mclBn_precomputeG2(lines + n, &q);
+
+    g2_to_mcl(&q, &vk->delta);
+    mclBnG2_neg(&q, &q);
+    mclBn_precomputeG2(lines + 2 * (size_t)n, &q);
+
+    /* Lines from an earlier vk_prepare; NULL on a fresh key */
+    vk_free_lines(vk);
+
+    vk->alpha_beta = alpha_beta;
+    vk->beta_lines = lines;
+    vk->neg_gamma_lines = lines + n;
+    vk->neg_delta_lines = lines + 2 * (size_t)n;
 
     return true;
 }
@@ -429,222 +478,234 @@ void vk_free(groth16_vk_t *vk) {
         vk->ic = NULL;
     }
     vk->ic_len = 0;
+    vk_free_lines(vk);
 }
 
-bool groth16_verify(
+bool groth16_verify_validated(
     const groth16_vk_t *vk,
-    const groth16_proof_t *proof,
+    const groth16_valid_proof_t *valid,
     const field_t *public_inputs,
     size_t num_inputs
 ) {
     if (!g_pairing_initialized) return false;
+    if (!vk->beta_lines) return false;
     if (num_inputs + 1 != vk->ic_len) return false;
 
-    /* Validate proof points */
-    if (!g1_is_on_curve(&proof->a) || !g1_is_in_subgroup(&proof->a)) return false;
-    if (!g2_is_on_curve(&proof->b) || !g2_is_in_subgroup(&proof->b)) return false;
-    if (!g1_is_on_curve(&proof->c) || !g1_is_in_subgroup(&proof->c)) return false;
+    const groth16_proof_t *proof = &valid->proof;
 
-    /* Compute IC accumulator: IC[0] + Σ(input[i] * IC[i+1]) */
-    g1_t ic_acc;
-    memcpy(&ic_acc, &vk->ic[0], sizeof(g1_t));
+    /* IC accumulator stays in mcl form: IC[0] + Σ(input[i] * IC[i+1]) */
+    mcl_g1_t mcl_ic, mcl_tmp;
+    mcl_fr_t mcl_s;
+    g1_to_mcl(&mcl_ic, &vk->ic[0]);
 
     for (size_t i = 0; i < num_inputs; i++) {
-        g1_t tmp;
-        g1_scalar_mul(&tmp, &vk->ic[i + 1], &public_inputs[i]);
-        g1_add(&ic_acc, &ic_acc, &tmp);
+        g1_to_mcl(&mcl_tmp, &vk->ic[i + 1]);
+        scalar_to_mcl(&mcl_s, &public_inputs[i]);
+        mclBnG1_mul(&mcl_tmp, &mcl_tmp, &mcl_s);
+        mclBnG1_add(&mcl_ic, &mcl_ic, &mcl_tmp);
     }
 
-    /* e(A,B) · e(-IC,γ) · e(-C,δ) = e(α,β) */
+    /*
+     * e(A,B) · e(IC,-γ) · e(C,-δ) = e(α,β)
+     * Only (A, B) needs a full Miller loop; -γ and -δ use prepared lines.
+     */
+    mcl_g1_t mcl_a, mcl_c;
+    mcl_g2_t mcl_b;
+    g1_to_mcl(&mcl_a, &proof->a);
+    g2_to_mcl(&mcl_b, &proof->b);
+    g1_to_mcl(&mcl_c, &proof->c);
+
+    mcl_gt_t f, f_ic;
+    mclBn_precomputedMillerLoop2mixed(&f, &mcl_a, &mcl_b, &mcl_c, vk->neg_delta_lines);
+    mclBn_precomputedMillerLoop(&f_ic, &mcl_ic, vk->neg_gamma_lines);
+    mclBnGT_mul(&f, &f, &f_ic);
+    mclBn_finalExp(&f, &f);
 
-    /* Negate points for the check */
-    g1_t neg_ic_acc, neg_c;
-    g1_neg(&neg_ic_acc, &ic_acc);
-    g1_neg(&neg_c, &proof->c);
+    /* Check if result equals precomputed e(α, β) */
+    return mclBnGT_isEqual(&f, gt_as_mcl_const(&vk->alpha_beta)) != 0;
+}
 
-    /* Compute multi-pairing: e(A, B) · e(-IC_acc, γ) · e(-C, δ) */
-    g1_t g1_points[3];
-    g2_t g2_points[3];
+/* Per-proof batch preparation, one chunk of proofs per task */
+typedef struct {
+    const groth16_valid_proof_t *proofs;
+    const scalar_t *rs;
+    point_t *c_points;
+    mcl_g1_t *ps;
+    mcl_g2_t *qs;
+} batch_prep_job_t;
 
-    memcpy(&g1_points[0], &proof->a, sizeof(g1_t));
-    memcpy(&g2_points[0], &proof->b, sizeof(g2_t));
+static void batch_prep_range(void *arg, size_t begin, size_t end) {
+    batch_prep_job_t *job = arg;
 
-    memcpy(&g1_points[1], &neg_ic_acc, sizeof(g1_t));
-    memcpy(&g2_points[1], &vk->gamma, sizeof(g2_t));
+    for (size_t i = begin; i < end; i++) {
+        const groth16_proof_t *proof = &job->proofs[i].proof;
 
-    memcpy(&g1_points[2], &neg_c, sizeof(g1_t));
-    memcpy(&g2_points[2], &vk->delta, sizeof(g2_t));
+        /* Pairing inputs (r_i·A_i, B_i) */
+        g1_to_mcl(&job->ps[i], &proof->a);
+        mclBnG1_mul(&job->ps[i], &job->ps[i], fr_as_mcl_const(&job->rs[i]));
+        g2_to_mcl(&job->qs[i], &proof->b);
 
-    gt_t lhs;
-    if (!pairing_multi(&lhs, g1_points, g2_points, 3)) {
-        return false;
+        g1_to_point(&job->c_points[i], &proof->c);
     }
-
-    /* Check if result equals precomputed e(α, β) */
-    return gt_eq(&lhs, &vk->alpha_beta);
 }
 
-/*
- * Generate cryptographic random scalar for batch verification.
- * Returns false on RNG failure (fail-closed).
- */
-static bool random_scalar(field_t *out) {
-#ifdef _WIN32
-    if (BCryptGenRandom(NULL, (PUCHAR)out->limbs, 32, BCRYPT_USE_SYSTEM_PREFERRED_RNG) != 0) {
-        return false;
-    }
-#else
-    int fd = open("/dev/urandom", O_RDONLY);
-    if (fd < 0) return false;
-    ssize_t n = read(fd, out->limbs, 32);
-    close(fd);
-    if (n != 32) return false;
-#endif
-    /* Reduce to 128 bits for sufficient security margin */
-    out->limbs[2] = 0;
-    out->limbs[3] = 0;
-    field_to_mont(out, out);
-    return true;
+/* Miller loops over one chunk of (r_i·A_i, B_i); partial products per chunk */
+typedef struct {
+    const mcl_g1_t *ps;
+    const mcl_g2_t *qs;
+    size_t grain;
+    mcl_gt_t *partials;
+} miller_job_t;
+
+static void miller_range(void *arg, size_t begin, size_t end) {
+    miller_job_t *job = arg;
+    mclBn_millerLoopVec(&job->partials[begin / job->grain],
+                        &job->ps[begin], &job->qs[begin], end - begin);
 }
 
-bool groth16_verify_batch(
+bool groth16_verify_batch_validated(
     const groth16_vk_t *vk,
-    const groth16_proof_t *proofs,
+    const groth16_valid_proof_t *proofs,
     const field_t **public_inputs,
     const size_t *num_inputs,
-    size_t num_proofs
+    size_t num_proofs,
+    const scalar_t *coeffs,
+    threadpool_t *pool
 ) {
     if (!g_pairing_initialized) return false;
+    if (!vk->beta_lines) return false;
     if (num_proofs == 0) return true;
 
     /* Small batches: verify individually (overhead not worth it) */
     if (num_proofs < 4) {
         for (size_t i = 0; i < num_proofs; i++) {
-            if (!groth16_verify(vk, &proofs[i], public_inputs[i], num_inputs[i])) {
+            if (!groth16_verify_validated(vk, &proofs[i], public_inputs[i], num_inputs[i])) {
                 return false;
             }
         }
         return true;
     }
 
+    size_t ic_len = vk->ic_len;
+    for (size_t i = 0; i < num_proofs; i++) {
+        if (num_inputs[i] + 1 != ic_len) return false;
+    }
+
     /*
      * Random linear combination: Σrᵢ(verification eq)ᵢ
-     * n+2 pairings total: n for (rᵢAᵢ, Bᵢ), plus IC and C accumulators.
+     * n full Miller loops for (rᵢAᵢ, Bᵢ); IC, C and α terms reuse the
+     * prepared -γ/-δ/β lines. One final exponentiation for the batch.
      */
 
+    /* Miller loop chunks: a few per thread so stealing can even out */
+    size_t threads = threadpool_size(pool);
+    size_t grain = (num_proofs + 4 * threads - 1) / (4 * threads);
+    if (grain < 8) grain = 8;
+    size_t num_chunks = (num_proofs + grain - 1) / grain;
+
     /* Use scratch arena for all temporary allocations */
     arena_t *scratch = scratch_arena_get();
     arena_checkpoint_t cp = arena_checkpoint(scratch);
 
-    size_t total_pairings = num_proofs + 2;
-    field_t *randoms = arena_alloc(scratch, num_proofs * sizeof(field_t));
-    g1_t *scaled_A = arena_alloc(scratch, num_proofs * sizeof(g1_t));
-    g1_t *g1_points = arena_alloc(scratch, total_pairings * sizeof(g1_t));
-    g2_t *g2_points = arena_alloc(scratch, total_pairings * sizeof(g2_t));
+    scalar_t *folded = arena_alloc(scratch, ic_len * sizeof(scalar_t));
+    scalar_t *rs = arena_alloc(scratch, num_proofs * sizeof(scalar_t));
+    point_t *c_points = arena_alloc(scratch, num_proofs * sizeof(point_t));
+    point_t *ic_points = arena_alloc(scratch, ic_len * sizeof(point_t));
+    mcl_g1_t *mcl_ps = arena_alloc(scratch, num_proofs * sizeof(mcl_g1_t));
+    mcl_g2_t *mcl_qs = arena_alloc(scratch, num_proofs * sizeof(mcl_g2_t));
+    mcl_gt_t *partials = arena_alloc(scratch, num_chunks * sizeof(mcl_gt_t));
 
-    if (!randoms || !scaled_A || !g1_points || !g2_points) {
+    if (!folded || !rs || !c_points || !ic_points || !mcl_ps || !mcl_qs || !partials) {
         arena_restore(scratch, cp);
         /* Fallback to sequential verification */
         for (size_t i = 0; i < num_proofs; i++) {
-            if (!groth16_verify(vk, &proofs[i], public_inputs[i], num_inputs[i])) {
+            if (!groth16_verify_validated(vk, &proofs[i], public_inputs[i], num_inputs[i])) {
                 return false;
             }
         }
         return true;
     }
 
-    /* Generate random scalars and validate proofs */
-    field_t r_sum;
-    field_set_zero(&r_sum);
-
-    for (size_t i = 0; i < num_proofs; i++) {
-        /* Validate proof points */
-        if (!g1_is_on_curve(&proofs[i].a) || !g1_is_in_subgroup(&proofs[i].a) ||
-            !g2_is_on_curve(&proofs[i].b) || !g2_is_in_subgroup(&proofs[i].b) ||
-            !g1_is_on_curve(&proofs[i].c) || !g1_is_in_subgroup(&proofs[i].c)) {
-            arena_restore(scratch, cp);
-            return false;
-        }
-
-        /* Generate random scalar (fail-closed on RNG failure) */
-        if (!random_scalar(&randoms[i])) {
-            arena_restore(scratch, cp);
-            return false;
-        }
+    /* Caller's coefficients, or one CSPRNG draw for the batch (fail-closed) */
+    if (coeffs) {
+        memcpy(rs, coeffs, num_proofs * sizeof(scalar_t));
+    } else if (!rng_scalars128(rs, num_proofs)) {
+        arena_restore(scratch, cp);
+        return false;
+    }
 
-        /* Accumulate r_sum for e(α,β)^(Σr_i) */
-        field_add(&r_sum, &r_sum, &randoms[i]);
+    /* r_i·A_i and the mcl conversions in parallel */
+    batch_prep_job_t prep = {
+        .proofs = proofs, .rs = rs, .c_points = c_points, .ps = mcl_ps, .qs = mcl_qs,
+    };
+    threadpool_for(pool, num_proofs, 16, batch_prep_range, &prep);
 
-        /* Compute r_i·A_i */
-        g1_scalar_mul(&scaled_A[i], &proofs[i].a, &randoms[i]);
+    /*
+     * The IC points are shared, so the per-proof IC sums fold in Fr:
+     *   Σᵢ rᵢ·(IC[0] + Σⱼ xᵢⱼ·IC[j+1])
+     *     = (Σᵢ rᵢ)·IC[0] + Σⱼ (Σᵢ rᵢ·xᵢⱼ)·IC[j+1]
+     * folded[0] = Σᵢ rᵢ doubles as the α exponent.
+     */
+    for (size_t j = 0; j < ic_len; j++) {
+        fr_set_zero(&folded[j]);
     }
 
-    /* Compute IC accumulator: Σ r_i · (IC[0] + Σ_j(input[j] * IC[j+1])) */
-    g1_t ic_acc;
-    g1_set_infinity(&ic_acc);
-
+    scalar_t s;
     for (size_t i = 0; i < num_proofs; i++) {
-        /* Compute IC for this proof */
-        g1_t ic_i;
-        memcpy(&ic_i, &vk->ic[0], sizeof(g1_t));
+        fr_add(&folded[0], &folded[0], &rs[i]);
         for (size_t j = 0; j < num_inputs[i]; j++) {
-            g1_t tmp;
-            g1_scalar_mul(&tmp, &vk->ic[j + 1], &public_inputs[i][j]);
-            g1_add(&ic_i, &ic_i, &tmp);
+            fr_from_field(&s, &public_inputs[i][j]);
+            fr_mul(&s, &s, &rs[i]);
+            fr_add(&folded[j + 1], &folded[j + 1], &s);
         }
-        /* Scale by r_i and accumulate */
-        g1_t scaled_ic;
-        g1_scalar_mul(&scaled_ic, &ic_i, &randoms[i]);
-        g1_add(&ic_acc, &ic_acc, &scaled_ic);
     }
 
-    /* Compute C accumulator: Σ r_i · C_i */
-    g1_t c_acc;
-    g1_set_infinity(&c_acc);
-    for (size_t i = 0; i < num_proofs; i++) {
-        g1_t scaled_c;
-        g1_scalar_mul(&scaled_c, &proofs[i].c, &randoms[i]);
-        g1_add(&c_acc, &c_acc, &scaled_c);
+    /*
+     * C accumulator Σ r_i·C_i as one MSM. The Jacobian result is handed to
+     * mcl as-is.
+     */
+    point_t acc;
+    mcl_g1_t c_acc, ic_acc;
+    point_msm(&acc, c_points, rs, num_proofs, pool);
+    point_to_mcl(&c_acc, &acc);
+
+    /* IC accumulator: an ic_len-term MSM regardless of batch size */
+    for (size_t j = 0; j < ic_len; j++) {
+        g1_to_point(&ic_points[j], &vk->ic[j]);
     }
+    point_msm(&acc, ic_points, folded, ic_len, pool);
+    point_to_mcl(&ic_acc, &acc);
 
-    /* Negate accumulators */
-    g1_t neg_ic_acc, neg_c_acc;
-    g1_neg(&neg_ic_acc, &ic_acc);
-    g1_neg(&neg_c_acc, &c_acc);
+    /* -(Σrᵢ)·α, so e(α,β)^(Σrᵢ) moves to the left-hand side */
+    mcl_g1_t neg_alpha;
+    g1_to_mcl(&neg_alpha, &vk->alpha);
+    mclBnG1_mul(&neg_alpha, &neg_alpha, fr_as_mcl_const(&folded[0]));
+    mclBnG1_neg(&neg_alpha, &neg_alpha);
 
     /*
-     * Compute LHS = Π e(r_i·A_i, B_i) · e(-IC_acc, γ) · e(-C_acc, δ)
-     * Use multi-Miller loop for efficiency.
+     * Π e(r_i·A_i, B_i) · e(IC_acc, -γ) · e(C_acc, -δ) · e(-Σrᵢ·α, β) = 1
+     * Miller loops run in chunks across the pool; the partial products
+     * and the VK terms are multiplied together before a single final
+     * exponentiation. The VK pairs use prepared lines.
      */
-
-    /* Set up pairing inputs */
-    for (size_t i = 0; i < num_proofs; i++) {
-        memcpy(&g1_points[i], &scaled_A[i], sizeof(g1_t));
-        memcpy(&g2_points[i], &proofs[i].b, sizeof(g2_t));
+    miller_job_t miller = {
+        .ps = mcl_ps, .qs = mcl_qs, .grain = grain, .partials = partials,
+    };
+    threadpool_for(pool, num_proofs, grain, miller_range, &miller);
+
+    mcl_gt_t f, f_vk;
+    mclBn_precomputedMillerLoop2(&f, &ic_acc, vk->neg_gamma_lines,
+                                 &c_acc, vk->neg_delta_lines);
+    mclBn_precomputedMillerLoop(&f_vk, &neg_alpha, vk->beta_lines);
+    mclBnGT_mul(&f, &f, &f_vk);
+    for (size_t c = 0; c < num_chunks; c++) {
+        mclBnGT_mul(&f, &f, &partials[c]);
     }
-    memcpy(&g1_points[num_proofs], &neg_ic_acc, sizeof(g1_t));
-    memcpy(&g2_points[num_proofs], &vk->gamma, sizeof(g2_t));
-    memcpy(&g1_points[num_proofs + 1], &neg_c_acc, sizeof(g1_t));
-    memcpy(&g2_points[num_proofs + 1], &vk->delta, sizeof(g2_t));
-
-    /* Compute multi-pairing */
-    gt_t lhs;
-    bool ok = pairing_multi(&lhs, g1_points, g2_points, total_pairings);
+    mclBn_finalExp(&f, &f);
 
     arena_restore(scratch, cp);
 
-    if (!ok) return false;
-
-    /* RHS: e(Σrᵢ·α, β) - cheaper than GT exponentiation */
-    g1_t scaled_alpha;
-    g1_scalar_mul(&scaled_alpha, &vk->alpha, &r_sum);
-
-    gt_t rhs;
-    if (!pairing_compute(&rhs, &scaled_alpha, &vk->beta)) {
-        return false;
-    }
-
-    return gt_eq(&lhs, &rhs);
+    return mclBnGT_isOne(&f) != 0;
 }
 
 #else /* !TETSUO_USE_MCL */
@@ -688,6 +749,16 @@ bool gt_eq(const gt_t *a, const gt_t *b) {
     return false;
 }
 
+size_t gt_serialize(uint8_t *out, size_t max_len, const gt_t *a) {
+    (void)out; (void)max_len; (void)a;
+    return 0;
+}
+
+bool gt_deserialize(gt_t *r, const uint8_t *data, size_t len) {
+    (void)r; (void)data; (void)len;
+    return false;
+}
+
 void g1_set_infinity(g1_t *p) {
     memset(p, 0, sizeof(*p));
     p->is_infinity = true;
@@ -697,16 +768,6 @@ bool g1_is_infinity(const g1_t *p) {
     return p->is_infinity;
 }
 
-bool g1_is_on_curve(const g1_t *p) {
-    (void)p;
-    return false;
-}
-
-bool g1_is_in_subgroup(const g1_t *p) {
-    (void)p;
-    return false;
-}
-
 void g1_add(g1_t *r, const g1_t *a, const g1_t *b) {
     (void)r; (void)a; (void)b;
 }
@@ -728,6 +789,285 @@ void g1_to_bytes(uint8_t *out, const g1_t *p) {
     (void)out; (void)p;
 }
 
+bool g2_from_bytes(g2_t *p, const uint8_t *data, size_t len) {
+    (void)p; (void)data; (void)len;
+    return false;
+}
+
+void g2_to_bytes(uint8_t *out, const g2_t *p) {
+    (void)out; (void)p;
+}
+
+bool vk_load(groth16_vk_t *vk, const uint8_t *data, size_t len) {
+    (void)vk; (void)data; (void)len;
+    return false;
+}
+
+void vk_free(groth16_vk_t *vk) {
+    (void)vk;
+}
+
+bool vk_prepare(groth16_vk_t *vk) {
+    (void)vk;
+    return false;
+}
+
+bool groth16_verify_validated(
+    const groth16_vk_t *vk,
+    const groth16_valid_proof_t *proof,
+    const field_t *public_inputs,
+    size_t num_inputs
+) {
+    (void)vk; (void)proof; (void)public_inputs; (void)num_inputs;
+    return false;
+}
+
+bool groth16_verify_batch_validated(
+    const groth16_vk_t *vk,
+    const groth16_valid_proof_t *proofs,
+    const field_t **public_inputs,
+    const size_t *num_inputs,
+    size_t num_proofs,
+    const scalar_t *coeffs,
+    threadpool_t *pool
+) {
+    (void)vk; (void)proofs; (void)public_inputs; (void)num_inputs; (void)num_proofs;
+    (void)coeffs; (void)pool;
+    return false;
+}
+
+#endif /* TETSUO_USE_MCL */
+
+/*
+ * Native G2 (shared by both builds)
+ *
+ * Same a = 0 Jacobian formulas as G1 in verify.c, over Fp2.
+ */
+
+/* b' = 3/(9 + u), Montgomery form */
+static const fp2_t TWIST_B = {
+    {{0x3BF938E377B802A8ULL, 0x020B1B273633535DULL,
+      0x26B7EDF049755260ULL, 0x2514C6324384A86DULL}},
+    {{0x38E7ECCCD1DCFF67ULL, 0x65F0B37D93CE0D3EULL,
+      0xD749D0DD22AC00AAULL, 0x0141B9CE4A688D4DULL}},
+};
+
+static void g2_coords(fp2_t *x, fp2_t *y, const g2_t *p) {
+    x->c0 = p->x_re;
+    x->c1 = p->x_im;
+    y->c0 = p->y_re;
+    y->c1 = p->y_im;
+}
+
+static void g2_jac_set_infinity(g2_jac_t *r) {
+    fp2_set_zero(&r->x);
+    fp2_set_one(&r->y);
+    fp2_set_zero(&r->z);
+}
+
+void g2_to_jac(g2_jac_t *r, const g2_t *p) {
+    if (p->is_infinity) {
+        g2_jac_set_infinity(r);
+        return;
+    }
+    g2_coords(&r->x, &r->y, p);
+    fp2_set_one(&r->z);
+}
+
+void g2_from_jac(g2_t *r, const g2_jac_t *p) {
+    if (g2_jac_is_infinity(p)) {
+        g2_set_infinity(r);
+        return;
+    }
+
+    fp2_t zinv, zinv2, x, y;
+    fp2_inv(&zinv, &p->z);
+    fp2_sqr(&zinv2, &zinv);
+    fp2_mul(&x, &p->x, &zinv2);
+    fp2_mul(&zinv2, &zinv2, &zinv);
+    fp2_mul(&y, &p->y, &zinv2);
+
+    r->x_re = x.c0;
+    r->x_im = x.c1;
+    r->y_re = y.c0;
+    r->y_im = y.c1;
+    r->is_infinity = false;
+}
+
+bool g2_jac_is_infinity(const g2_jac_t *p) {
+    return fp2_is_zero(&p->z);
+}
+
+/* Y² = X³ + b'·Z⁶ */
+bool g2_jac_is_on_curve(const g2_jac_t *p) {
+    if (g2_jac_is_infinity(p)) return true;
+
+    fp2_t lhs, rhs, t;
+    fp2_sqr(&lhs, &p->y);
+    fp2_sqr(&rhs, &p->x);
+    fp2_mul(&rhs, &rhs, &p->x);
+    fp2_sqr(&t, &p->z);
+    fp2_mul(&t, &t, &p->z);
+    fp2_sqr(&t, &t);
+    fp2_mul(&t, &t, &TWIST_B);
+    fp2_add(&rhs, &rhs, &t);
+    return fp2_eq(&lhs, &rhs);
+}
+
+void g2_jac_double(g2_jac_t *r, const g2_jac_t *p) {
+    if (g2_jac_is_infinity(p)) {
+        *r = *p;
+        return;
+    }
+
+    fp2_t a, b, c, d, e, f, tmp;
+
+    fp2_sqr(&a, &p->x);
+    fp2_sqr(&b, &p->y);
+    fp2_sqr(&c, &b);
+
+    fp2_add(&tmp, &p->x, &b);
+    fp2_sqr(&d, &tmp);
+    fp2_sub(&d, &d, &a);
+    fp2_sub(&d, &d, &c);
+    fp2_add(&d, &d, &d);
+
+    fp2_add(&e, &a, &a);
+    fp2_add(&e, &e, &a);
+    fp2_sqr(&f, &e);
+
+    /* Z3 first: r may alias p */
+    fp2_mul(&r->z, &p->y, &p->z);
+    fp2_add(&r->z, &r->z, &r->z);
+
+    fp2_sub(&r->x, &f, &d);
+    fp2_sub(&r->x, &r->x, &d);
+
+    fp2_sub(&tmp, &d, &r->x);
+    fp2_mul(&r->y, &e, &tmp);
+    fp2_add(&c, &c, &c);
+    fp2_add(&c, &c, &c);
+    fp2_add(&c, &c, &c);
+    fp2_sub(&r->y, &r->y, &c);
+}
+
+void g2_jac_add(g2_jac_t *r, const g2_jac_t *p, const g2_jac_t *q) {
+    if (g2_jac_is_infinity(p)) { *r = *q; return; }
+    if (g2_jac_is_infinity(q)) { *r = *p; return; }
+
+    fp2_t z1z1, z2z2, u1, u2, s1, s2, h, i, j, rr, v;
+
+    fp2_sqr(&z1z1, &p->z);
+    fp2_sqr(&z2z2, &q->z);
+    fp2_mul(&u1, &p->x, &z2z2);
+    fp2_mul(&u2, &q->x, &z1z1);
+    fp2_mul(&s1, &p->y, &q->z);
+    fp2_mul(&s1, &s1, &z2z2);
+    fp2_mul(&s2, &q->y, &p->z);
+    fp2_mul(&s2, &s2, &z1z1);
+
+    fp2_sub(&h, &u2, &u1);
+    fp2_sub(&rr, &s2, &s1);
+    if (fp2_is_zero(&h)) {
+        if (fp2_is_zero(&rr)) {
+            g2_jac_double(r, p);
+        } else {
+            g2_jac_set_infinity(r);
+        }
+        return;
+    }
+
+    fp2_add(&i, &h, &h);
+    fp2_sqr(&i, &i);
+    fp2_mul(&j, &h, &i);
+    fp2_add(&rr, &rr, &rr);
+    fp2_mul(&v, &u1, &i);
+
+    fp2_t x3, y3;
+    fp2_sqr(&x3, &rr);
+    fp2_sub(&x3, &x3, &j);
+    fp2_sub(&x3, &x3, &v);
+    fp2_sub(&x3, &x3, &v);
+
+    fp2_sub(&y3, &v, &x3);
+    fp2_mul(&y3, &y3, &rr);
+    fp2_mul(&s1, &s1, &j);
+    fp2_add(&s1, &s1, &s1);
+    fp2_sub(&y3, &y3, &s1);
+
+    fp2_add(&r->z, &p->z, &q->z);
+    fp2_sqr(&r->z, &r->z);
+    fp2_sub(&r->z, &r->z, &z1z1);
+    fp2_sub(&r->z, &r->z, &z2z2);
+    fp2_mul(&r->z, &r->z, &h);
+    r->x = x3;
+    r->y = y3;
+}
+
+/* k·P for a public 128-bit integer k, double-and-add from the top bit */
+static void g2_jac_mul_u128(g2_jac_t *r, const g2_jac_t *p, const uint64_t k[2]) {
+    g2_jac_t acc;
+    int top = k[1] ? 127 - __builtin_clzll(k[1]) : k[0] ? 63 - __builtin_clzll(k[0]) : -1;
+
+    g2_jac_set_infinity(&acc);
+    for (int i = top; i >= 0; i--) {
+        g2_jac_double(&acc, &acc);
+        if ((k[i / 64] >> (i % 64)) & 1) {
+            g2_jac_add(&acc, &acc, p);
+        }
+    }
+    *r = acc;
+}
+
+/* Same point: X1·Z2² = X2·Z1² and Y1·Z2³ = Y2·Z1³ */
+static bool g2_jac_eq(const g2_jac_t *p, const g2_jac_t *q) {
+    bool pi = g2_jac_is_infinity(p), qi = g2_jac_is_infinity(q);
+    if (pi || qi) return pi == qi;
+
+    fp2_t z1z1, z2z2, a, b, c, d;
+    fp2_sqr(&z1z1, &p->z);
+    fp2_sqr(&z2z2, &q->z);
+    fp2_mul(&a, &p->x, &z2z2);
+    fp2_mul(&b, &q->x, &z1z1);
+    if (!fp2_eq(&a, &b)) return false;
+
+    fp2_mul(&z2z2, &z2z2, &q->z);
+    fp2_mul(&z1z1, &z1z1, &p->z);
+    fp2_mul(&c, &p->y, &z2z2);
+    fp2_mul(&d, &q->y, &z1z1);
+    return fp2_eq(&c, &d);
+}
+
+/*
+ * ψ = twist⁻¹ ∘ Frobenius ∘ twist:
+ *   ψ(x, y) = (conj(x)·ξ^((p-1)/3), conj(y)·ξ^((p-1)/2)), ξ = 9 + u
+ * Conjugation is a field automorphism, so it applies to Jacobian
+ * coordinates directly (Z -> conj(Z)).
+ */
+static const fp2_t PSI_COEFF_X = {
+    {{0xB5773B104563AB30ULL, 0x347F91C8A9AA6454ULL,
+      0x7A007127242E0991ULL, 0x1956BCD8118214ECULL}},
+    {{0x6E849F1EA0AA4757ULL, 0xAA1C7B6D89F89141ULL,
+      0xB6E713CDFAE0CA3AULL, 0x26694FBB4E82EBC3ULL}},
+};
+static const fp2_t PSI_COEFF_Y = {
+    {{0xE4BBDD0C2936B629ULL, 0xBB30F162E133BACBULL,
+      0x31A9D1B6F9645366ULL, 0x253570BEA500F8DDULL}},
+    {{0xA1D77CE45FFE77C7ULL, 0x07AFFD117826D1DBULL,
+      0x6D16BD27BB7EDC6BULL, 0x2C87200285DEFECCULL}},
+};
+
+void g2_jac_psi(g2_jac_t *r, const g2_jac_t *p) {
+    fp2_frobenius(&r->x, &p->x);
+    fp2_mul(&r->x, &r->x, &PSI_COEFF_X);
+    fp2_frobenius(&r->y, &p->y);
+    fp2_mul(&r->y, &r->y, &PSI_COEFF_Y);
+    fp2_frobenius(&r->z, &p->z);
+}
+
+/* 6x² = p - r for the BN parameter x = 4965661367192848881 */
+static const uint64_t BN_6X2[2] = {0xF83E9682E87CFD46ULL, 0x6F4D8248EEB859FBULL};
+
 void g2_set_infinity(g2_t *p) {
     memset(p, 0, sizeof(*p));
     p->is_infinity = true;
@@ -738,39 +1078,347 @@ bool g2_is_infinity(const g2_t *p) {
 }
 
 bool g2_is_on_curve(const g2_t *p) {
-    (void)p;
-    return false;
+    if (p->is_infinity) return true;
+
+    fp2_t x, y, lhs, rhs;
+    g2_coords(&x, &y, p);
+    fp2_sqr(&lhs, &y);
+    fp2_sqr(&rhs, &x);
+    fp2_mul(&rhs, &rhs, &x);
+    fp2_add(&rhs, &rhs, &TWIST_B);
+    return fp2_eq(&lhs, &rhs);
+}
+
+bool g2_jac_is_in_subgroup(const g2_jac_t *p) {
+    g2_jac_t lhs, rhs;
+    g2_jac_psi(&lhs, p);
+    g2_jac_mul_u128(&rhs, p, BN_6X2);
+    return g2_jac_eq(&lhs, &rhs);
 }
 
 bool g2_is_in_subgroup(const g2_t *p) {
-    (void)p;
-    return false;
+    if (p->is_infinity) return true;
+
+    g2_jac_t q;
+    g2_to_jac(&q, p);
+    return g2_jac_is_in_subgroup(&q);
 }
 
 void g2_add(g2_t *r, const g2_t *a, const g2_t *b) {
-    (void)r; (void)a; (void)b;
+    g2_jac_t ja, jb;
+    g2_to_jac(&ja, a);
+    g2_to_jac(&jb, b);
+    g2_jac_add(&ja, &ja, &jb);
+    g2_from_jac(r, &ja);
 }
 
 void g2_neg(g2_t *r, const g2_t *p) {
-    (void)r; (void)p;
+    *r = *p;
+    if (!p->is_infinity) {
+        field_neg(&r->y_re, &p->y_re);
+        field_neg(&r->y_im, &p->y_im);
+    }
 }
 
-bool g2_from_bytes(g2_t *p, const uint8_t *data, size_t len) {
-    (void)p; (void)data; (void)len;
-    return false;
+/*
+ * Aggregate G2 subgroup check
+ *
+ * The twist group has square-free order r·h with cofactor
+ * h = 2p - r = 10069 · 5864401 · 1875725156269 · q (q a 178-bit prime),
+ * so it is cyclic and each point splits into one component per prime ℓ.
+ * For T = Σ sᵢ·Pᵢ, fix every sⱼ but one sᵢ whose Pᵢ has a nonzero
+ * ℓ-component: that component of T vanishes only if sᵢ hits a single
+ * residue mod ℓ, which b-bit uniform sᵢ does with probability at most
+ * ⌈2^b/ℓ⌉/2^b. Per round and per factor:
+ *
+ *   ℓ                  128-bit round   14-bit round
+ *   10069 (13.3 bits)  2^-13.3         2/2^14 = 2^-13
+ *   5864401 (22.5)     2^-22.5         2^-14
+ *   1875725156269 (41) 2^-40.8         2^-14
+ *   q (178)            2^-128          2^-14
+ *
+ * The wide round alone covers only q; the small factors need the narrow
+ * rounds. Rounds draw independent sᵢ, so one wide round plus nine 14-bit
+ * rounds give 2^-130.3 for 10069, 2^-148.5 for 5864401, 2^-166.8 for
+ * 1875725156269 and 2^-254 for q. A point bad in several components is
+ * missed only if all of them vanish, so the batch passes a point outside
+ * G2 with probability at most 2^-130. Each round is an n-term MSM and a
+ * single ψ test, against n 127-bit multiplications for per-point checks.
+ * Rounds run across the pool.
+ */
+#define G2_BATCH_ROUNDS 10
+#define G2_BATCH_NARROW_BITS 14
+
+/* Below this many points, per-point checks are cheaper */
+#define G2_BATCH_MIN 48
+
+typedef struct {
+    const g2_jac_t *points;
+    const uint64_t (*k)[2];     /* n scalars per round */
+    size_t n;
+    _Atomic(bool) rejected;
+    _Atomic(bool) failed;       /* Out of scratch */
+} g2_batch_job_t;
+
+static uint64_t u128_window(const uint64_t k[2], unsigned bit, unsigned c) {
+    uint64_t w = k[bit / 64] >> (bit % 64);
+    if (bit % 64 + c > 64 && bit / 64 == 0) {
+        w |= k[1] << (64 - bit % 64);
+    }
+    return w & (((uint64_t)1 << c) - 1);
 }
 
-void g2_to_bytes(uint8_t *out, const g2_t *p) {
-    (void)out; (void)p;
+/* Pippenger over `bits`-bit scalars, buckets from this thread's scratch */
+static bool g2_jac_msm(g2_jac_t *r, const g2_jac_t *points, const uint64_t (*k)[2],
+                       size_t n, unsigned bits) {
+    unsigned c = 3, log2n = 0;
+    while ((n >> log2n) > 1) log2n++;
+    if (log2n > 5) c = log2n - 2;
+    if (c > bits) c = bits;
+    size_t num_buckets = ((size_t)1 << c) - 1;
+
+    arena_t *scratch = scratch_arena_get();
+    arena_checkpoint_t cp = arena_checkpoint(scratch);
+    g2_jac_t *buckets = arena_alloc(scratch, num_buckets * sizeof(g2_jac_t));
+    if (!buckets) {
+        arena_restore(scratch, cp);
+        return false;
+    }
+
+    g2_jac_set_infinity(r);
+    for (unsigned w = (bits + c - 1) / c; w-- > 0; ) {
+        for (unsigned d = 0; d < c; d++) {
+            g2_jac_double(r, r);
+        }
+        for (size_t b = 0; b < num_buckets; b++) {
+            g2_jac_set_infinity(&buckets[b]);
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            uint64_t digit = u128_window(k[i], w * c, c);
+            if (digit) {
+                g2_jac_add(&buckets[digit - 1], &buckets[digit - 1], &points[i]);
+            }
+        }
+
+        g2_jac_t running, sum;
+        g2_jac_set_infinity(&running);
+        g2_jac_set_infinity(&sum);
+        for (size_t b = num_buckets; b-- > 0; ) {
+            g2_jac_add(&running, &running, &buckets[b]);
+            g2_jac_add(&sum, &sum, &running);
+        }
+        g2_jac_add(r, r, &sum);
+    }
+
+    arena_restore(scratch, cp);
+    return true;
 }
 
-bool vk_load(groth16_vk_t *vk, const uint8_t *data, size_t len) {
-    (void)vk; (void)data; (void)len;
-    return false;
+static void g2_batch_rounds(void *arg, size_t begin, size_t end) {
+    g2_batch_job_t *job = arg;
+
+    for (size_t round = begin; round < end; round++) {
+        if (atomic_load_explicit(&job->rejected, memory_order_relaxed)) return;
+
+        g2_jac_t t;
+        unsigned bits = round == 0 ? 128 : G2_BATCH_NARROW_BITS;
+        if (!g2_jac_msm(&t, job->points, &job->k[round * job->n], job->n, bits)) {
+            atomic_store(&job->failed, true);
+            return;
+        }
+        if (!g2_jac_is_in_subgroup(&t)) {
+            atomic_store(&job->rejected, true);
+            return;
+        }
+    }
 }
 
-void vk_free(groth16_vk_t *vk) {
-    (void)vk;
+#define G2_BATCH_SEED_TAG "tetsuo-g2-subgroup-v1"
+
+/* out = H(tag || seed || 0) || H(tag || seed || 1) || ..., truncated to len */
+static void g2_batch_expand_seed(uint8_t *out, size_t len, const uint8_t *seed) {
+    uint8_t block[SHA256_DIGEST_SIZE];
+    for (uint64_t ctr = 0; len > 0; ctr++) {
+        uint8_t c[8];
+        for (int i = 0; i < 8; i++) c[i] = (uint8_t)(ctr >> (8 * i));
+
+        sha256_ctx_t h;
+        sha256_init(&h);
+        sha256_update(&h, G2_BATCH_SEED_TAG, sizeof(G2_BATCH_SEED_TAG) - 1);
+        sha256_update(&h, seed, GROTH16_BATCH_SEED_SIZE);
+        sha256_update(&h, c, sizeof(c));
+        sha256_final(&h, block);
+
+        size_t take = len < sizeof(block) ? len : sizeof(block);
+        memcpy(out, block, take);
+        out += take;
+        len -= take;
+    }
+}
+
+/* 1 accepted, 0 rejected, -1 not run (scratch or RNG unavailable) */
+static int g2_batch_aggregate(const g2_t *points, size_t n, const uint8_t *seed,
+                              threadpool_t *pool) {
+    arena_t *scratch = scratch_arena_get();
+    arena_checkpoint_t cp = arena_checkpoint(scratch);
+
+    size_t k_len = G2_BATCH_ROUNDS * n * sizeof(uint64_t[2]);
+    g2_jac_t *jac = arena_alloc(scratch, n * sizeof(g2_jac_t));
+    uint64_t (*k)[2] = arena_alloc(scratch, k_len);
+    if (!jac || !k) {
+        arena_restore(scratch, cp);
+        return -1;
+    }
+    if (seed) {
+        g2_batch_expand_seed((uint8_t *)k, k_len, seed);
+    } else if (!rng_bytes(k, k_len)) {
+        arena_restore(scratch, cp);
+        return -1;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        g2_to_jac(&jac[i], &points[i]);
+    }
+
+    /* Round 0 keeps all 128 bits; the rest are cut to 14 */
+    for (size_t i = n; i < G2_BATCH_ROUNDS * n; i++) {
+        k[i][0] &= ((uint64_t)1 << G2_BATCH_NARROW_BITS) - 1;
+        k[i][1] = 0;
+    }
+
+    g2_batch_job_t job = { .points = jac, .k = (const uint64_t (*)[2])k, .n = n };
+    atomic_store(&job.rejected, false);
+    atomic_store(&job.failed, false);
+    threadpool_for(pool, G2_BATCH_ROUNDS, 1, g2_batch_rounds, &job);
+
+    arena_restore(scratch, cp);
+    if (atomic_load(&job.rejected)) return 0;
+    return atomic_load(&job.failed) ? -1 : 1;
+}
+
+/* Per-point checks over one chunk; stops early when no flags are wanted */
+typedef struct {
+    const g2_t *points;
+    bool *valid;
+    _Atomic(bool) rejected;
+} g2_check_job_t;
+
+static void g2_check_range(void *arg, size_t begin, size_t end) {
+    g2_check_job_t *job = arg;
+
+    for (size_t i = begin; i < end; i++) {
+        if (!job->valid && atomic_load_explicit(&job->rejected, memory_order_relaxed)) return;
+
+        bool ok = g2_is_on_curve(&job->points[i]) && g2_is_in_subgroup(&job->points[i]);
+        if (job->valid) job->valid[i] = ok;
+        if (!ok) atomic_store(&job->rejected, true);
+    }
+}
+
+bool g2_batch_is_in_subgroup(const g2_t *points, size_t n, bool *valid,
+                             const uint8_t *seed, threadpool_t *pool) {
+    bool on_curve = true;
+    for (size_t i = 0; i < n && on_curve; i++) {
+        on_curve = g2_is_on_curve(&points[i]);
+    }
+
+    if (on_curve && n >= G2_BATCH_MIN) {
+        int agg = g2_batch_aggregate(points, n, seed, pool);
+        if (agg == 1) {
+            for (size_t i = 0; valid && i < n; i++) valid[i] = true;
+            return true;
+        }
+        if (agg == 0 && !valid) return false;
+    } else if (!on_curve && !valid) {
+        return false;
+    }
+
+    /* Small batch, flags wanted after a rejection, or no aggregate */
+    g2_check_job_t job = { .points = points, .valid = valid };
+    atomic_store(&job.rejected, false);
+    threadpool_for(pool, n, 4, g2_check_range, &job);
+    return !atomic_load(&job.rejected);
+}
+
+/* b = 3, Montgomery form */
+static const field_t G1_B = {{
+    0x7a17caa950ad28d7ULL, 0x1f6ac17ae15521b9ULL,
+    0x334bea4e696bd284ULL, 0x2a1f6744ce179d8eULL,
+}};
+
+/* y² = x³ + 3 */
+bool g1_is_on_curve(const g1_t *p) {
+    if (p->is_infinity) return true;
+
+    field_t lhs, rhs;
+    field_sqr(&lhs, &p->y);
+    field_sqr(&rhs, &p->x);
+    field_mul(&rhs, &rhs, &p->x);
+    field_add(&rhs, &rhs, &G1_B);
+    return field_eq(&lhs, &rhs);
+}
+
+/* BN254 G1 has cofactor 1: every curve point is in the order-r group */
+bool g1_is_in_subgroup(const g1_t *p) {
+    return g1_is_on_curve(p);
+}
+
+/*
+ * Proof validation (shared by both builds)
+ *
+ * The intended producers of groth16_valid_proof_t. All checks are native;
+ * nothing here goes through mcl.
+ */
+
+bool groth16_proof_validate(groth16_valid_proof_t *out, const groth16_proof_t *proof) {
+    if (!g1_is_on_curve(&proof->a) || !g1_is_on_curve(&proof->c)) return false;
+    if (!g2_is_on_curve(&proof->b) || !g2_is_in_subgroup(&proof->b)) return false;
+
+    out->proof = *proof;
+    return true;
+}
+
+bool groth16_proofs_validate(groth16_valid_proof_t *out, bool *valid,
+                             const groth16_proof_t *proofs, size_t n,
+                             const uint8_t *seed, threadpool_t *pool) {
+    arena_t *scratch = scratch_arena_get();
+    arena_checkpoint_t cp = arena_checkpoint(scratch);
+    g2_t *bs = arena_alloc(scratch, n * sizeof(g2_t));
+    bool *b_ok = valid ? arena_alloc(scratch, n * sizeof(bool)) : NULL;
+
+    if (!bs || (valid && !b_ok)) {
+        arena_restore(scratch, cp);
+        /* One proof at a time */
+        bool all = true;
+        for (size_t i = 0; i < n; i++) {
+            bool ok = groth16_proof_validate(&out[i], &proofs[i]);
+            if (valid) valid[i] = ok;
+            all &= ok;
+            if (!all && !valid) break;
+        }
+        return all;
+    }
+
+    /* G1 on-curve checks here, then every B through one aggregate check */
+    bool all = true;
+    for (size_t i = 0; i < n; i++) {
+        bool ok = g1_is_on_curve(&proofs[i].a) && g1_is_on_curve(&proofs[i].c);
+        if (valid) valid[i] = ok;
+        all &= ok;
+        if (!all && !valid) break;
+
+        bs[i] = proofs[i].b;
+        out[i].proof = proofs[i];
+    }
+
+    if (all || valid) {
+        all &= g2_batch_is_in_subgroup(bs, n, b_ok, seed, pool);
+        for (size_t i = 0; valid && i < n; i++) valid[i] &= b_ok[i];
+    }
+
+    arena_restore(scratch, cp);
+    return all;
 }
 
 bool groth16_verify(
@@ -779,8 +1427,9 @@ bool groth16_verify(
     const field_t *public_inputs,
     size_t num_inputs
 ) {
-    (void)vk; (void)proof; (void)public_inputs; (void)num_inputs;
-    return false;
+    groth16_valid_proof_t valid;
+    if (!groth16_proof_validate(&valid, proof)) return false;
+    return groth16_verify_validated(vk, &valid, public_inputs, num_inputs);
 }
 
 bool groth16_verify_batch(
@@ -788,10 +1437,165 @@ bool groth16_verify_batch(
     const groth16_proof_t *proofs,
     const field_t **public_inputs,
     const size_t *num_inputs,
-    size_t num_proofs
+    size_t num_proofs,
+    const scalar_t *coeffs,
+    threadpool_t *pool
 ) {
-    (void)vk; (void)proofs; (void)public_inputs; (void)num_inputs; (void)num_proofs;
-    return false;
+    if (!pairing_is_initialized()) return false;
+
+    arena_t *scratch = scratch_arena_get();
+    arena_checkpoint_t cp = arena_checkpoint(scratch);
+    groth16_valid_proof_t *valid = arena_alloc(scratch, num_proofs * sizeof(*valid));
+
+    bool ok;
+    if (valid) {
+        ok = groth16_proofs_validate(valid, NULL, proofs, num_proofs, NULL, pool) &&
+             groth16_verify_batch_validated(vk, valid, public_inputs, num_inputs,
+                                            num_proofs, coeffs, pool);
+    } else {
+        /* Out of scratch: one proof at a time */
+        ok = true;
+        for (size_t i = 0; i < num_proofs && ok; i++) {
+            ok = groth16_verify(vk, &proofs[i], public_inputs[i], num_inputs[i]);
+        }
+    }
+
+    arena_restore(scratch, cp);
+    return ok;
 }
 
-#endif /* TETSUO_USE_MCL */
+void g1_msm(g1_t *r, const g1_t *points, const scalar_t *scalars, size_t n) {
+    arena_t *scratch = scratch_arena_get();
+    arena_checkpoint_t cp = arena_checkpoint(scratch);
+
+    point_t acc;
+    point_t *jac = arena_alloc(scratch, n * sizeof(point_t));
+
+    if (!jac) {
+        /* Fallback: one term at a time */
+        arena_restore(scratch, cp);
+        point_t p, t;
+        point_set_infinity(&acc);
+        for (size_t i = 0; i < n; i++) {
+            g1_to_point(&p, &points[i]);
+            point_msm(&t, &p, &scalars[i], 1, NULL);
+            point_add(&acc, &acc, &t);
+        }
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            g1_to_point(&jac[i], &points[i]);
+        }
+        point_msm(&acc, jac, scalars, n, NULL);
+        arena_restore(scratch, cp);
+    }
+
+    if (point_is_infinity(&acc)) {
+        g1_set_infinity(r);
+        return;
+    }
+    point_to_affine_vartime(&acc, &acc);
+    r->is_infinity = false;
+    field_copy(&r->x, &acc.x);
+    field_copy(&r->y, &acc.y);
+}
+
+/*
+ * Batch transcript
+ *
+ * Points are absorbed as an infinity flag followed by their Montgomery
+ * limbs; the encoding is fixed-length per element, so the transcript is
+ * unambiguous without separators.
+ */
+
+#define BATCH_TRANSCRIPT_TAG "tetsuo-groth16-batch-v1"
+
+static void absorb_u64(sha256_ctx_t *h, uint64_t v) {
+    uint8_t b[8];
+    for (int i = 0; i < 8; i++) b[i] = (uint8_t)(v >> (8 * i));
+    sha256_update(h, b, 8);
+}
+
+static void absorb_field(sha256_ctx_t *h, const field_t *f) {
+    uint8_t b[32];
+    field_to_bytes(b, f);
+    sha256_update(h, b, 32);
+}
+
+static void absorb_g1(sha256_ctx_t *h, const g1_t *p) {
+    uint8_t inf = p->is_infinity ? 1 : 0;
+    const field_t zero = {{0}};
+    sha256_update(h, &inf, 1);
+    absorb_field(h, inf ? &zero : &p->x);
+    absorb_field(h, inf ? &zero : &p->y);
+}
+
+static void absorb_g2(sha256_ctx_t *h, const g2_t *p) {
+    uint8_t inf = p->is_infinity ? 1 : 0;
+    const field_t zero = {{0}};
+    sha256_update(h, &inf, 1);
+    absorb_field(h, inf ? &zero : &p->x_re);
+    absorb_field(h, inf ? &zero : &p->x_im);
+    absorb_field(h, inf ? &zero : &p->y_re);
+    absorb_field(h, inf ? &zero : &p->y_im);
+}
+
+void groth16_batch_coeffs(
+    scalar_t *coeffs,
+    uint8_t *seed_out,
+    const groth16_vk_t *vk,
+    const groth16_proof_t *proofs,
+    const field_t **public_inputs,
+    const size_t *num_inputs,
+    size_t num_proofs
+) {
+    sha256_ctx_t h;
+    uint8_t vk_digest[SHA256_DIGEST_SIZE];
+    uint8_t seed[SHA256_DIGEST_SIZE];
+
+    /* VK digest */
+    sha256_init(&h);
+    absorb_g1(&h, &vk->alpha);
+    absorb_g2(&h, &vk->beta);
+    absorb_g2(&h, &vk->gamma);
+    absorb_g2(&h, &vk->delta);
+    absorb_u64(&h, vk->ic_len);
+    for (size_t j = 0; j < vk->ic_len; j++) {
+        absorb_g1(&h, &vk->ic[j]);
+    }
+    sha256_final(&h, vk_digest);
+
+    /* seed = H(tag || vk_digest || n || (A, B, C, m, inputs)*) */
+    sha256_init(&h);
+    sha256_update(&h, BATCH_TRANSCRIPT_TAG, sizeof(BATCH_TRANSCRIPT_TAG) - 1);
+    sha256_update(&h, vk_digest, sizeof(vk_digest));
+    absorb_u64(&h, num_proofs);
+    for (size_t i = 0; i < num_proofs; i++) {
+        absorb_g1(&h, &proofs[i].a);
+        absorb_g2(&h, &proofs[i].b);
+        absorb_g1(&h, &proofs[i].c);
+        absorb_u64(&h, num_inputs[i]);
+        for (size_t j = 0; j < num_inputs[i]; j++) {
+            absorb_field(&h, &public_inputs[i][j]);
+        }
+    }
+    sha256_final(&h, seed);
+    if (seed_out) memcpy(seed_out, seed, sizeof(seed));
+
+    /* coeffs[i] = low 128 bits of H(seed || i), always < r */
+    uint8_t block[SHA256_DIGEST_SIZE + 8];
+    uint8_t out[SHA256_DIGEST_SIZE];
+    memcpy(block, seed, sizeof(seed));
+    for (size_t i = 0; i < num_proofs; i++) {
+        for (int k = 0; k < 8; k++) {
+            block[SHA256_DIGEST_SIZE + k] = (uint8_t)((uint64_t)i >> (8 * k));
+        }
+        sha256(out, block, sizeof(block));
+
+        fr_set_zero(&coeffs[i]);
+        for (int k = 0; k < 8; k++) {
+            coeffs[i].limbs[0] |= (uint64_t)out[k] << (8 * k);
+            coeffs[i].limbs[1] |= (uint64_t)out[8 + k] << (8 * k);
+        }
+        fr_to_mont(&coeffs[i], &coeffs[i]);
+    }
+}
@@ -8,6 +8,8 @@
 #define TETSUO_PAIRING_H
 
 #include "field.h"
+#include "scalar.h"
+#include "threadpool.h"
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -35,12 +37,16 @@ typedef struct {
 
 /*
  * GT element (target group, subgroup of Fp12)
- * Stored as opaque 384-byte buffer (mcl internal format)
+ * Twelve Montgomery-form Fp coefficients, laid out as mcl's in-memory Fp12.
+ * Opaque: use gt_serialize/gt_deserialize to move values across the API.
  */
 typedef struct {
-    uint8_t data[384];
+    field_t c[12];
 } gt_t;
 
+/* Serialized GT size in bytes */
+#define GT_SERIALIZED_SIZE 384
+
 /*
  * Groth16 verification key
  */
@@ -53,6 +59,14 @@ typedef struct groth16_vk {
     size_t ic_len;   /* Number of IC points */
     /* Precomputed pairings for efficiency */
     gt_t alpha_beta; /* e(α, β) */
+    /*
+     * Prepared G2 line coefficients (built by vk_prepare; NULL until then).
+     * Each buffer holds the Miller loop lines for one fixed VK point,
+     * so verification only runs the full loop for the proof's B.
+     */
+    uint64_t *beta_lines;       /* β */
+    uint64_t *neg_gamma_lines;  /* -γ */
+    uint64_t *neg_delta_lines;  /* -δ */
 } groth16_vk_t;
 
 /*
@@ -64,6 +78,18 @@ typedef struct {
     g1_t c;          /* C ∈ G1 */
 } groth16_proof_t;
 
+/*
+ * Groth16 proof whose points passed validation: A and C on the curve
+ * (G1 has cofactor 1), B on the twist and in G2. By convention only the
+ * groth16_proof(s)_validate functions fill one in; the type is not
+ * opaque, so this is not enforced. The _validated verifiers take it
+ * without re-checking, so each check runs once, and a hand-filled one
+ * skips the checks entirely.
+ */
+typedef struct {
+    groth16_proof_t proof;
+} groth16_valid_proof_t;
+
 /* Initialize pairing library. Must be called before other functions. */
 bool pairing_init(void);
 
@@ -94,6 +120,12 @@ bool gt_is_one(const gt_t *a);
 /* Check if two GT elements are equal */
 bool gt_eq(const gt_t *a, const gt_t *b);
 
+/* GT wire format. Returns bytes written (0 on failure). */
+size_t gt_serialize(uint8_t *out, size_t max_len, const gt_t *a);
+
+/* Parse and validate a serialized GT element */
+bool gt_deserialize(gt_t *r, const uint8_t *data, size_t len);
+
 /*
  * G1 operations
  */
@@ -107,8 +139,12 @@ void g1_neg(g1_t *r, const g1_t *p);
 bool g1_from_bytes(g1_t *p, const uint8_t *data, size_t len);
 void g1_to_bytes(uint8_t *out, const g1_t *p);
 
+/* r = Σ scalars[i]·points[i] (Pippenger, native; scalars in Montgomery form) */
+void g1_msm(g1_t *r, const g1_t *points, const scalar_t *scalars, size_t n);
+
 /*
- * G2 operations
+ * G2 operations. Validation, addition and negation are native (fp2_t);
+ * only serialization goes through mcl.
  */
 void g2_set_infinity(g2_t *p);
 bool g2_is_infinity(const g2_t *p);
@@ -119,18 +155,91 @@ void g2_neg(g2_t *r, const g2_t *p);
 bool g2_from_bytes(g2_t *p, const uint8_t *data, size_t len);
 void g2_to_bytes(uint8_t *out, const g2_t *p);
 
+/* Jacobian G2 on the twist y² = x³ + 3/(9 + u) (infinity has Z = 0) */
+typedef struct {
+    fp2_t x;
+    fp2_t y;
+    fp2_t z;
+} g2_jac_t;
+
+void g2_to_jac(g2_jac_t *r, const g2_t *p);
+void g2_from_jac(g2_t *r, const g2_jac_t *p);
+bool g2_jac_is_infinity(const g2_jac_t *p);
+bool g2_jac_is_on_curve(const g2_jac_t *p);
+void g2_jac_add(g2_jac_t *r, const g2_jac_t *p, const g2_jac_t *q);
+void g2_jac_double(g2_jac_t *r, const g2_jac_t *p);
+
+/* Untwist-Frobenius-twist endomorphism; acts as [p] = [6x²] on G2 */
+void g2_jac_psi(g2_jac_t *r, const g2_jac_t *p);
+
+/*
+ * Order-r membership for a point already on the twist: ψ(P) = [6x²]P.
+ * A 127-bit multiplication instead of one by r. ψ acts on each prime
+ * component of the twist as a root of X² - tX + p, and 6x² is such a
+ * root mod r but not mod any prime of the cofactor 2p - r = 10069 ·
+ * 5864401 · 1875725156269 · (178-bit prime), so every point with a
+ * cofactor component fails (El Housni, Guillevic, Piellard, ePrint
+ * 2022/352).
+ */
+bool g2_jac_is_in_subgroup(const g2_jac_t *p);
+
+/* Transcript seed size for the batch functions below */
+#define GROTH16_BATCH_SEED_SIZE 32
+
+/*
+ * Subgroup check for a batch of G2 points: one randomized aggregate
+ * (ten rounds of Σ sᵢ·Pᵢ, soundness error below 2^-128) in place of n
+ * ψ tests once n is large enough. Points off the twist are rejected.
+ * `valid`, if not NULL, receives a flag per point; the per-point checks
+ * behind it run only when the aggregate rejects. The sᵢ are expanded
+ * from `seed` (GROTH16_BATCH_SEED_SIZE bytes) with SHA-256 when given;
+ * the seed must commit to every point, as the groth16_batch_coeffs one
+ * does. With NULL they come from the per-thread CSPRNG, falling back to
+ * per-point checks if it fails.
+ */
+bool g2_batch_is_in_subgroup(const g2_t *points, size_t n, bool *valid,
+                             const uint8_t *seed, threadpool_t *pool);
+
 /*
  * Verification key operations
  */
 bool vk_load(groth16_vk_t *vk, const uint8_t *data, size_t len);
 void vk_free(groth16_vk_t *vk);
 
+/*
+ * Precompute e(α, β) and the G2 line coefficients for β, -γ and -δ.
+ * Called by vk_load; needed only for keys assembled by hand, whose line
+ * pointers must start NULL (zero the key before filling it in). The key
+ * owns the lines: preparing again replaces them, vk_free releases them,
+ * and a failed call leaves the key as it was.
+ * Verification fails closed on a VK that has not been prepared.
+ */
+bool vk_prepare(groth16_vk_t *vk);
+
+/*
+ * Proof validation, native in both builds. Infinity is accepted for any
+ * point; callers with stricter rules check it themselves.
+ */
+bool groth16_proof_validate(groth16_valid_proof_t *out, const groth16_proof_t *proof);
+
+/*
+ * Validate n proofs, with every B in one aggregate G2 subgroup check
+ * (g2_batch_is_in_subgroup). `valid`, if not NULL, receives a flag per
+ * proof and out[i] is filled for every flagged proof; with NULL, out is
+ * filled only when all n pass. Returns true when all n pass. `seed` is
+ * passed through to the aggregate check (NULL = CSPRNG).
+ */
+bool groth16_proofs_validate(groth16_valid_proof_t *out, bool *valid,
+                             const groth16_proof_t *proofs, size_t n,
+                             const uint8_t *seed, threadpool_t *pool);
+
 /*
  * Groth16 verification
  *
  * Verifies: e(A, B) = e(α, β) · e(Σ IC[i]·input[i], γ) · e(C, δ)
  *
- * Returns true if proof is valid, false otherwise.
+ * Returns true if proof is valid, false otherwise. groth16_verify
+ * validates first; groth16_verify_validated goes straight to the pairing.
  */
 bool groth16_verify(
     const groth16_vk_t *vk,
@@ -138,14 +247,58 @@ bool groth16_verify(
     const field_t *public_inputs,
     size_t num_inputs
 );
+bool groth16_verify_validated(
+    const groth16_vk_t *vk,
+    const groth16_valid_proof_t *proof,
+    const field_t *public_inputs,
+    size_t num_inputs
+);
 
 /*
  * Batch Groth16 verification using random linear combination
  *
  * More efficient than verifying proofs individually.
- * Uses random coefficients to combine multiple verification equations.
+ * Uses random coefficients to combine multiple verification equations:
+ * `coeffs` supplies one 128-bit Montgomery scalar per proof, or NULL to
+ * draw them from the per-thread CSPRNG.
+ * Checks, MSMs and Miller loops run on `pool` (NULL = calling thread).
+ * groth16_verify_batch runs groth16_proofs_validate first; the
+ * _validated form takes proofs that already passed it.
  */
 bool groth16_verify_batch(
+    const groth16_vk_t *vk,
+    const groth16_proof_t *proofs,
+    const field_t **public_inputs,
+    const size_t *num_inputs,
+    size_t num_proofs,
+    const scalar_t *coeffs,
+    threadpool_t *pool
+);
+bool groth16_verify_batch_validated(
+    const groth16_vk_t *vk,
+    const groth16_valid_proof_t *proofs,
+    const field_t **public_inputs,
+    const size_t *num_inputs,
+    size_t num_proofs,
+    const scalar_t *coeffs,
+    threadpool_t *pool
+);
+
+/*
+ * Fiat-Shamir batch coefficients (native, no RNG)
+ *
+ * Hashes a SHA-256 transcript of the VK, every proof and every public
+ * input, then derives coeffs[i] as 128 bits of H(seed || i). Any change
+ * to the batch changes every coefficient, so they can stand in for
+ * random ones. `seed_out`, if not NULL, receives the seed; passing it to
+ * groth16_proofs_validate derives the subgroup check from the same
+ * transcript, so validation plus groth16_verify_batch_validated replays
+ * bit-for-bit with no RNG. (groth16_verify_batch always validates with
+ * the CSPRNG.)
+ */
+void groth16_batch_coeffs(
+    scalar_t *coeffs,
+    uint8_t *seed_out,
     const groth16_vk_t *vk,
     const groth16_proof_t *proofs,
     const field_t **public_inputs,
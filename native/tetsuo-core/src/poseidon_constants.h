@@ -18,6 +18,23 @@
 #define POSEIDON_FULL_ROUNDS 8
 #define POSEIDON_PARTIAL_ROUNDS 57
 
+/*
+ * Poseidon MDS matrix (t=3, circomlib compatible)
+ * Cauchy construction ensures maximum distance separability.
+ * Limbs are little-endian and used as-is as Montgomery-form elements.
+ */
+static const uint64_t POSEIDON_MDS[3][3][4] = {
+    {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL},
+     {0x2e2419f9ec02ec39ULL, 0x85045b68181585d9ULL, 0x30644e72e131a029ULL, 0x0000000000000001ULL},
+     {0x3c208c16d87cfd46ULL, 0x97816a916871ca8dULL, 0xb85045b68181585dULL, 0x30644e72e131a029ULL}},
+    {{0x2e2419f9ec02ec39ULL, 0x85045b68181585d9ULL, 0x30644e72e131a029ULL, 0x0000000000000001ULL},
+     {0x3c208c16d87cfd46ULL, 0x97816a916871ca8dULL, 0xb85045b68181585dULL, 0x30644e72e131a029ULL},
+     {0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+    {{0x3c208c16d87cfd46ULL, 0x97816a916871ca8dULL, 0xb85045b68181585dULL, 0x30644e72e131a029ULL},
+     {0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL},
+     {0x2e2419f9ec02ec39ULL, 0x85045b68181585d9ULL, 0x30644e72e131a029ULL, 0x0000000000000001ULL}}
+};
+
 /*
  * Round constants in hex string format for runtime conversion.
  * Each constant is a 256-bit field element.
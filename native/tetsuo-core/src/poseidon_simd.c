@@ -0,0 +1,113 @@
+/*
+ * Multi-lane Poseidon: AVX-512 IFMA kernel
+ *
+ * Eight permutations run side by side, one per 64-bit lane, on the
+ * 5x52-bit arithmetic from field_ifma.h. Inputs and outputs stay in the
+ * library's R = 2^256 form; the kernel converts at the edges with one
+ * multiplication each way.
+ */
+
+#include "poseidon_simd.h"
+
+#ifdef TETSUO_HAVE_IFMA_KERNEL
+
+#include "poseidon_tables_r52.h"
+
+IFMA_FN void fe8_sbox(fe8_t *x) {
+    fe8_t x2, x4;
+    fe8_mul(&x2, x, x);
+    fe8_mul(&x4, &x2, &x2);
+    fe8_mul(x, &x4, x);
+}
+
+IFMA_FN void fe8_add_const(fe8_t *x, const uint64_t c[5]) {
+    fe8_t k;
+    fe8_const(&k, c);
+    fe8_add(x, x, &k);
+}
+
+IFMA_FN void fe8_mds(fe8_t s[3], const uint64_t m[3][3][5]) {
+    fe8_t tmp[3], k, prod;
+    for (int j = 0; j < 3; j++) {
+        fe8_const(&k, m[j][0]);
+        fe8_mul(&tmp[j], &k, &s[0]);
+        for (int i = 1; i < 3; i++) {
+            fe8_const(&k, m[j][i]);
+            fe8_mul(&prod, &k, &s[i]);
+            fe8_add(&tmp[j], &tmp[j], &prod);
+        }
+    }
+    s[0] = tmp[0];
+    s[1] = tmp[1];
+    s[2] = tmp[2];
+}
+
+/* Sparse partial-round matrix, rows (w0, w1, w2, v0, v1) */
+IFMA_FN void fe8_sparse(fe8_t s[3], const uint64_t sp[5][5]) {
+    fe8_t s0, k, prod;
+    fe8_const(&k, sp[0]);
+    fe8_mul(&s0, &k, &s[0]);
+    fe8_const(&k, sp[1]);
+    fe8_mul(&prod, &k, &s[1]);
+    fe8_add(&s0, &s0, &prod);
+    fe8_const(&k, sp[2]);
+    fe8_mul(&prod, &k, &s[2]);
+    fe8_add(&s0, &s0, &prod);
+
+    fe8_const(&k, sp[3]);
+    fe8_mul(&prod, &k, &s[0]);
+    fe8_add(&s[1], &s[1], &prod);
+    fe8_const(&k, sp[4]);
+    fe8_mul(&prod, &k, &s[0]);
+    fe8_add(&s[2], &s[2], &prod);
+    s[0] = s0;
+}
+
+IFMA_FN void fe8_full_round(fe8_t s[3], const uint64_t rc[3][5]) {
+    for (int j = 0; j < 3; j++) {
+        fe8_add_const(&s[j], rc[j]);
+        fe8_sbox(&s[j]);
+    }
+    fe8_mds(s, POSEIDON_MDS_R52);
+}
+
+__attribute__((target("avx512f,avx512ifma")))
+void poseidon_hash_ifma8(field_t out[FIELD_IFMA_LANES], const field_t *inputs,
+                         size_t arity) {
+    fe8_t s[3];
+    for (size_t k = 0; k < 3; k++) {
+        if (k < arity) {
+            fe8_load(&s[k], &inputs[k], arity);
+        } else {
+            fe8_zero(&s[k]);
+        }
+    }
+
+    for (int r = 0; r < POSEIDON_HALF_FULL; r++) {
+        fe8_full_round(s, POSEIDON_FULL_RC_R52[r]);
+    }
+
+    for (int r = 0; r < POSEIDON_PARTIAL - 1; r++) {
+        fe8_add_const(&s[0], POSEIDON_PARTIAL_RC_R52[r]);
+        fe8_sbox(&s[0]);
+        fe8_sparse(s, POSEIDON_SPARSE_R52[r]);
+    }
+    fe8_add_const(&s[0], POSEIDON_PARTIAL_RC_R52[POSEIDON_PARTIAL - 1]);
+    fe8_sbox(&s[0]);
+    fe8_mds(s, POSEIDON_MDS_LAST_R52);
+
+    for (int r = POSEIDON_HALF_FULL; r < 2 * POSEIDON_HALF_FULL; r++) {
+        fe8_full_round(s, POSEIDON_FULL_RC_R52[r]);
+    }
+
+    fe8_store(out, &s[0]);
+}
+
+#else /* !TETSUO_HAVE_IFMA_KERNEL */
+
+void poseidon_hash_ifma8(field_t out[FIELD_IFMA_LANES], const field_t *inputs,
+                         size_t arity) {
+    (void)out; (void)inputs; (void)arity;
+}
+
+#endif /* TETSUO_HAVE_IFMA_KERNEL */
@@ -0,0 +1,22 @@
+/*
+ * Multi-lane Poseidon kernels
+ *
+ * Internal to verify.c: poseidon_hash_many picks a kernel here and falls
+ * back to the scalar permutation for whatever is left over.
+ */
+
+#ifndef TETSUO_POSEIDON_SIMD_H
+#define TETSUO_POSEIDON_SIMD_H
+
+#include "field_ifma.h"
+
+/*
+ * Eight independent permutations in 5x52-bit structure-of-arrays form.
+ * inputs holds 8 consecutive groups of `arity` (1..3) Montgomery field
+ * elements; out[i] receives the hash of group i. Bit-identical to the
+ * scalar poseidon_hash. Only call when field_ifma_available().
+ */
+void poseidon_hash_ifma8(field_t out[FIELD_IFMA_LANES], const field_t *inputs,
+                         size_t arity);
+
+#endif /* TETSUO_POSEIDON_SIMD_H */
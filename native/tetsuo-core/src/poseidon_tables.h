@@ -0,0 +1,695 @@
+/*
+ * Poseidon tables (t=3, R_F=8, R_P=57), Montgomery form
+ *
+ * Generated by tools/gen_poseidon_tables.c from poseidon_constants.h.
+ * Do not edit.
+ */
+
+#ifndef POSEIDON_TABLES_H
+#define POSEIDON_TABLES_H
+
+#include "field.h"
+#include "arena.h"
+
+#define POSEIDON_HALF_FULL 4
+#define POSEIDON_PARTIAL 49
+
+/*
+ * Sparse partial-round matrix
+ *   [ w0  w1  w2 ]
+ *   [ v0  1   0  ]
+ *   [ v1  0   1  ]
+ */
+typedef struct {
+    field_t w[3];
+    field_t v[2];
+} poseidon_sparse_t;
+
+/* MDS matrix */
+static const _Alignas(CACHE_LINE_SIZE) field_t POSEIDON_MDS_MONT[3][3] = {
+    {
+        {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+        {{0x2e2419f9ec02ec39ULL, 0x85045b68181585d9ULL, 0x30644e72e131a029ULL, 0x0000000000000001ULL}},
+        {{0x3c208c16d87cfd46ULL, 0x97816a916871ca8dULL, 0xb85045b68181585dULL, 0x30644e72e131a029ULL}}
+    },
+    {
+        {{0x2e2419f9ec02ec39ULL, 0x85045b68181585d9ULL, 0x30644e72e131a029ULL, 0x0000000000000001ULL}},
+        {{0x3c208c16d87cfd46ULL, 0x97816a916871ca8dULL, 0xb85045b68181585dULL, 0x30644e72e131a029ULL}},
+        {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}}
+    },
+    {
+        {{0x3c208c16d87cfd46ULL, 0x97816a916871ca8dULL, 0xb85045b68181585dULL, 0x30644e72e131a029ULL}},
+        {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+        {{0x2e2419f9ec02ec39ULL, 0x85045b68181585d9ULL, 0x30644e72e131a029ULL, 0x0000000000000001ULL}}
+    }
+};
+
+/* Full-round constants; row 4 carries the folded partial-round remainder */
+static const _Alignas(CACHE_LINE_SIZE) field_t POSEIDON_FULL_RC[8][3] = {
+    {
+        {{0xc286e185fb38b8a1ULL, 0x2758a8d6a269ebb8ULL, 0x42bc9034fe06e301ULL, 0x2163275b18f792e5ULL}},
+        {{0xfabab6138805f0a6ULL, 0xa34c9b5cace25e92ULL, 0x93e04b5dc9c3fa2dULL, 0x1a13254c5b689edcULL}},
+        {{0x3ea0f42128b90715ULL, 0xdfba43f51650f938ULL, 0x252e829fe8649c73ULL, 0x25b5cca74828c30eULL}}
+    },
+    {
+        {{0x9ad60fecddf7449dULL, 0xa611317ab5666392ULL, 0x3c4f365f0eb27ee8ULL, 0x0673b811ee786d8dULL}},
+        {{0xab95c320b82961f7ULL, 0xda1ee3d179dac817ULL, 0x41e3370cb137f5ecULL, 0x2e8e78821a87de94ULL}},
+        {{0xea5be46b679e41a2ULL, 0x444a1170afa7940fULL, 0x674af2c69aba85e8ULL, 0x1e88235816cc779fULL}}
+    },
+    {
+        {{0x8a0fb30ce9c76b58ULL, 0x5d40dcdbd7da17a2ULL, 0xcc4c1f51f6a008b8ULL, 0x2a45c0fac6b1e0d6ULL}},
+        {{0xa1b27f9d7b8a85d0ULL, 0x87c42e9f6d936dbdULL, 0x36363b9b39ee162bULL, 0x18882c8b66d13d3cULL}},
+        {{0x5b60b8686b49fbcbULL, 0x1fbe8384a090ca28ULL, 0x9e16dec41222f072ULL, 0x1ad45972bc1675e1ULL}}
+    },
+    {
+        {{0x4a523557d20c492cULL, 0xdaaa447f64518ed5ULL, 0xe31035156183e19aULL, 0x1842fb55ff87055aULL}},
+        {{0x2a038a6e41fd1c72ULL, 0x09c2f2e72c812e95ULL, 0xbf3a22433ca95b42ULL, 0x0c568c62ece70065ULL}},
+        {{0x13bbe8337ebee9e0ULL, 0x2ab26e0fcbcddf21ULL, 0x25aa3fc7a802e147ULL, 0x090c2d4fa8f0befaULL}}
+    },
+    {
+        {{0x77c72c1e2f28cfdcULL, 0x4fac38d10e8cc09cULL, 0x5f16b69c1dc8a65bULL, 0x1301b479db060b60ULL}},
+        {{0x677dfed1912cf001ULL, 0xfeca57724ed0e90eULL, 0x135e17c216cd9ce2ULL, 0x2b2d9b6c52fb954bULL}},
+        {{0xcfd6719f71216a20ULL, 0x5c1b2c81ee91d16fULL, 0x44e269f9632ce6f1ULL, 0x14bf1524f625a22fULL}}
+    },
+    {
+        {{0x99d5e36c4287c44cULL, 0xd761f0223e1326cdULL, 0x71e75db3ab857ba7ULL, 0x3013b37c969974f9ULL}},
+        {{0x642bb4c143b45797ULL, 0xe52b34c249f4a90bULL, 0x755503a326a5a2c2ULL, 0x0a9aa4d5b398e96aULL}},
+        {{0x2aec8b1d80cbd006ULL, 0xdf815280d9d9d28aULL, 0xb47d7c14d257f3a5ULL, 0x077c4adb9ab037ddULL}}
+    },
+    {
+        {{0xb34dcf7da7e702cbULL, 0x680b959fd87e66caULL, 0xbab5a980ab3f895fULL, 0x25cddaa10c592c86ULL}},
+        {{0xa455d152c839b72fULL, 0x0c5b2bf6abbf9c4cULL, 0xf233882022bea170ULL, 0x1d1e56e24bc9b44eULL}},
+        {{0x8c09855b7ed79f06ULL, 0xa628245310e88515ULL, 0x09a2329eb02e2e4bULL, 0x25025b01aa856563ULL}}
+    },
+    {
+        {{0x9297172382a9cce9ULL, 0x508a03da715c168bULL, 0xe9f7a6562add20caULL, 0x04a32064280ef49cULL}},
+        {{0x76b30d42759ad0acULL, 0x0b9fd034dc3b9de7ULL, 0xa2aa0a53e769e145ULL, 0x2952fa02a0f64e4aULL}},
+        {{0x1432b82c5ed47b07ULL, 0xc15cc9b659d1a719ULL, 0xa7a61b9f47fd98ceULL, 0x1dc6acf79ac94b34ULL}}
+    }
+};
+
+/* Partial-round constants (state[0] only) */
+static const _Alignas(CACHE_LINE_SIZE) field_t POSEIDON_PARTIAL_RC[49] = {
+    {{0xde80c4f1a7941c53ULL, 0x85a8697364ded491ULL, 0xf66efb8e98050fc2ULL, 0x17c746cced4c5063ULL}},
+    {{0x8eb999c9fa1e9e48ULL, 0x07fbe5106313133eULL, 0x6c7cf7a68f97139eULL, 0x062068d84ec02a57ULL}},
+    {{0xa5282dd988d2fb33ULL, 0x2e7f7edd141db90bULL, 0x5a71db5f4c5bf5a2ULL, 0x11d182b80f21b1c7ULL}},
+    {{0xb15a1ac934fbf9a0ULL, 0x03ae6406f94e14aeULL, 0x227192d13095a759ULL, 0x14b13f06d39cc736ULL}},
+    {{0x1d60c4e6133a3faeULL, 0x1db77a96ea215cacULL, 0xa0ad5bdbdfc91d7fULL, 0x3025276ce618a4baULL}},
+    {{0xadd6c4d52664eaa7ULL, 0xe2a33ca6b5bd469fULL, 0x9cde7c32b16282f7ULL, 0x19375fc3643e1538ULL}},
+    {{0x527e95ee64aa26e6ULL, 0xe5ac57920b461868ULL, 0x49e1c5d4b67e5cfaULL, 0x13375c672d7a75ceULL}},
+    {{0x2493657b394c2e5cULL, 0xb3654ad8cd2142a5ULL, 0x9c377d5528b0ad30ULL, 0x298c802c2fdcd4e6ULL}},
+    {{0x536008d3097ba057ULL, 0xad504460fa52de7bULL, 0x64bee3f238f89c07ULL, 0x07923c9fc7f819dfULL}},
+    {{0x7a33724ce3c5a60cULL, 0xd386c535be3dc0a5ULL, 0x06b65e1f41a0ed4fULL, 0x2afdf6a12c865a64ULL}},
+    {{0xb2363ddddf461acfULL, 0x80ef1a8b5cadf15dULL, 0xcc6a084a52f2cf5cULL, 0x281eea0296fdc24eULL}},
+    {{0xd97a3d2c4e782d71ULL, 0x328a7261915d5b7aULL, 0x622ebbd85b43afb7ULL, 0x1a8fb3060dbe1c7eULL}},
+    {{0x1c34322116abd530ULL, 0xf0a014dbb279e1c9ULL, 0xcc88912920804b32ULL, 0x170454eb8eee4563ULL}},
+    {{0x3c33ed892d2ba981ULL, 0x3c6801b2e5156da7ULL, 0x8788dc0d56ab5335ULL, 0x024a0af87aaf1a5aULL}},
+    {{0x111026ff33b90c6bULL, 0x41874e99e2e82339ULL, 0xcdc981840b39f104ULL, 0x2c70590bb386e8fdULL}},
+    {{0xd403dd5b3f84819bULL, 0x1a72bb277caa82a2ULL, 0x7558a8543d1d17f3ULL, 0x00aed46c0220efb2ULL}},
+    {{0x7e4401cf91383246ULL, 0x9e1ba6bb2c595eabULL, 0xa913d18ad5b5fcf4ULL, 0x28accebfc4c0c711ULL}},
+    {{0xd0cf860912634baaULL, 0x386b91710cdccf29ULL, 0xb0022d41a178cdd0ULL, 0x0bb96924aa2f5649ULL}},
+    {{0x307ec91152d91662ULL, 0x59650126103bdad3ULL, 0x8f88b65e8224732bULL, 0x2dac17b25e61fdf7ULL}},
+    {{0x8b61eb4eabd3e39eULL, 0xe9814779065dcf90ULL, 0x56c7ab66cdb18795ULL, 0x0c8dee9579689564ULL}},
+    {{0xb8666b9112503ffeULL, 0x25160b58f1322f5eULL, 0x606bcce05a40e954ULL, 0x29e2779f3b6cbf65ULL}},
+    {{0xc50ad1f07cf95ff5ULL, 0x98e938d570a3581aULL, 0x7f83ea2beb0accd7ULL, 0x1fe3fe006f25b5dfULL}},
+    {{0x8a08f5f6ef5530beULL, 0x4f6aad0f7d735d7aULL, 0x64a54aaf94d2791aULL, 0x252d95ff5edfe99fULL}},
+    {{0xeeb53b3f20f75907ULL, 0x7164bddfe6a67638ULL, 0x94a755303095830dULL, 0x2e332668b2282c7cULL}},
+    {{0x527b8ff29cee7945ULL, 0xd687fa98209ca5b6ULL, 0x452ee95d25a8ff64ULL, 0x154c14e27385604cULL}},
+    {{0x3ba7b2b11898f6ceULL, 0x3ee91ee73082f776ULL, 0x10fdbe150199ba37ULL, 0x2789724d3669323dULL}},
+    {{0x3799dc65c245d5b2ULL, 0xf7ee0c6a503c367dULL, 0x4a424c378ea9a597ULL, 0x1e84c9da98e8580cULL}},
+    {{0x3910968aca51afc8ULL, 0xc44a637ed0aab1c2ULL, 0xdda09348948efa4aULL, 0x213c3ef409a50b02ULL}},
+    {{0x19fbedc8683b0955ULL, 0xc6d4c43e7072dd77ULL, 0x5020a539dc17a5c7ULL, 0x16782edb9d9aa573ULL}},
+    {{0x036d3235f9053cc1ULL, 0x6ab7f91cf1bb19e5ULL, 0x4a607688eb093ce1ULL, 0x1bcd7a0da6bbd0f8ULL}},
+    {{0xc7ae4284c05bc3c2ULL, 0xb3f542b310a3098bULL, 0x4a039d7eaaf3665cULL, 0x2f4602d50f7ca794ULL}},
+    {{0xb400ba6853fa5451ULL, 0xd56f9545d0c0fc2cULL, 0xebb73e0a074798fbULL, 0x175140750869b376ULL}},
+    {{0x9ddca955ed87fe8cULL, 0xce1c4da4bc6b8eb9ULL, 0xe0757318026c5849ULL, 0x01e9b3bcc192caeeULL}},
+    {{0x72e9f3d6721fc675ULL, 0xc64eb3b3f48f694aULL, 0x10442cb2295a21ccULL, 0x22f4a72404ac55daULL}},
+    {{0x2378904213628e97ULL, 0xf2c2995c9fceb184ULL, 0x0cabbc6e098ae36aULL, 0x006800ee2bb643a7ULL}},
+    {{0x08d09ec907f15887ULL, 0x5a36471bdd5c6d39ULL, 0x39b9b2b580e9024fULL, 0x1ae740be8c67d2e5ULL}},
+    {{0x44fe36ec97e89fe1ULL, 0x1b8324d162ed2e9aULL, 0xdfb78bedab0b4823ULL, 0x0b4844aa27ef510dULL}},
+    {{0x9f3f9337688eeb24ULL, 0x96f9b4047ddd6590ULL, 0x7de57add50e35555ULL, 0x2493296a22cd3e98ULL}},
+    {{0xa9612c50d0c77195ULL, 0x9cdb93ca86e8e252ULL, 0x78a802d9a4df0a77ULL, 0x164673da6dbe572dULL}},
+    {{0xd95d4b553eedb7f4ULL, 0x53502d32c3d1d403ULL, 0x4facfd5ac9f6e239ULL, 0x07865513821c84c4ULL}},
+    {{0x1601eeb4872d3463ULL, 0x4083275d0bd013d9ULL, 0x2499a5a31dbe71b3ULL, 0x00a0e19db31cbfecULL}},
+    {{0xd7c3119b75f669b8ULL, 0x8a514bc529f7b3faULL, 0x33b62bbc3cec511dULL, 0x28e5a57cb28404bfULL}},
+    {{0x4fb71ff71c582a0eULL, 0xeeb10bc37ef72703ULL, 0xa4c7bb365ffd3ab1ULL, 0x0f128da58c345afdULL}},
+    {{0x74ab18ec64977be4ULL, 0x8bb3e66c163c8bafULL, 0x277c182cb6ff1b3fULL, 0x0cfecf9171685708ULL}},
+    {{0x54ae7b466c77ea24ULL, 0x251f020c3318ff77ULL, 0xa84042113d157cdeULL, 0x2394be12243535e3ULL}},
+    {{0xea54d48503998ac3ULL, 0x53a65fde215562ccULL, 0xb6882ebb483bc8c1ULL, 0x21b029e01a0e33acULL}},
+    {{0xc14f1ce966bd175dULL, 0x0e0ca8d8261eb275ULL, 0xcb0ef60bf47ce045ULL, 0x0c244008b082e839ULL}},
+    {{0x76f11268a1b7afd4ULL, 0x8a6c08107304a53eULL, 0x306c309098846ab8ULL, 0x16eba4894355c617ULL}},
+    {{0x816963bb96c3b045ULL, 0x15f76a5046dad94fULL, 0x3685aff511594ae0ULL, 0x13d0ee76cfd72c6cULL}}
+};
+
+/* Sparse matrices for partial rounds 0..47 */
+static const _Alignas(CACHE_LINE_SIZE) poseidon_sparse_t POSEIDON_SPARSE[48] = {
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x2e2419f9ec02ec39ULL, 0x85045b68181585d9ULL, 0x30644e72e131a029ULL, 0x0000000000000001ULL}},
+            {{0x3c208c16d87cfd46ULL, 0x97816a916871ca8dULL, 0xb85045b68181585dULL, 0x30644e72e131a029ULL}}
+        },
+        .v = {
+            {{0x1c69c29fcc7c3cbaULL, 0xfa61a194d350cc8dULL, 0x4e668730ca8215f0ULL, 0x0c49720b303a0527ULL}},
+            {{0xd2ac3b009cd45893ULL, 0x720ce0bf172a16aaULL, 0x9588e5ef915619aaULL, 0x0685f0e28fc716b5ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x5dd35711a4d9ec15ULL, 0x7b528f78ffbefaf2ULL, 0x2fb8d5f9116facc7ULL, 0x2ddb6332d272e8ebULL}},
+            {{0xa59e1a74c1976093ULL, 0x6fd9d81d6431b691ULL, 0x3516575abf0a52e2ULL, 0x19875d49d4368768ULL}}
+        },
+        .v = {
+            {{0xbdb43e075b9fa39aULL, 0x88d1edc06c95baa9ULL, 0x2336d54af5d22021ULL, 0x2df10d645b531f9fULL}},
+            {{0xe0129f3a0e84d01cULL, 0x4ea9bbba7acb2853ULL, 0xe1c4f858f9a060ffULL, 0x2317ace4932f4dacULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x4c4f11681490a332ULL, 0x926bd5d3637695bcULL, 0x80d96fb6b8adc060ULL, 0x067aa5ba2fde6dadULL}},
+            {{0x8f6f9181e5bdb60aULL, 0xbcecccf66f04d4b9ULL, 0xef6f88d4c2b053a6ULL, 0x0b51d47303233c15ULL}}
+        },
+        .v = {
+            {{0xccf7dab89d675b27ULL, 0xd8e1ef7875748217ULL, 0x5b01c134a784109bULL, 0x0008c419386ef8faULL}},
+            {{0xc3ab0b591732b7c7ULL, 0xaf71edaaf7969a0bULL, 0x78554d1eba695ab7ULL, 0x206e8e8c502a26cfULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x2805f85cddee8236ULL, 0xbd34346c0fa86996ULL, 0xd43fbeaf5ce9fab5ULL, 0x186bd70f1baa78fbULL}},
+            {{0xe9a12cce78d609c6ULL, 0x0e7830509ad003e2ULL, 0x1817c1125a2548dfULL, 0x1155328c5d52169aULL}}
+        },
+        .v = {
+            {{0x586c50b01300f021ULL, 0x6afbc3c5cf6ea522ULL, 0xfe36d4c9684dfbb1ULL, 0x1280bf137d89a81cULL}},
+            {{0x264604d00051d0e7ULL, 0x9980ace4a2436cb2ULL, 0x47650710fd669bcfULL, 0x26e30e7934ccdfa5ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x7e75aafc5f8dc6b6ULL, 0x61ba3cc8978eb73dULL, 0x948d41d78996456aULL, 0x2e674a9886c8849cULL}},
+            {{0x353bc1763bc7d7bfULL, 0x1172aab2a8d4412dULL, 0xc625837019384a90ULL, 0x2cd8a7de127a1770ULL}}
+        },
+        .v = {
+            {{0xaaef0941698de57aULL, 0x9bcde9465e5408f9ULL, 0x7448fb88b167b9bcULL, 0x06d4a96b6a507fb4ULL}},
+            {{0x5f5db4342167f6c7ULL, 0x5a3ea866687a17feULL, 0x4c55cc28a26cf656ULL, 0x214dd898dc46c186ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x358149a8bc4cb186ULL, 0x2b9194602dba5d70ULL, 0x04c871278f50a494ULL, 0x0f9a1d75add6dd39ULL}},
+            {{0xa8944b1e7444d434ULL, 0x996fd980a5d3ab82ULL, 0xa5d38dd2fcefa7ffULL, 0x30112e8dc662d7c2ULL}}
+        },
+        .v = {
+            {{0xcfa60ae5d3a80e3bULL, 0xc59307a90a617c5bULL, 0x47b36c31f6ffd733ULL, 0x2e10a7b8e6bf32f1ULL}},
+            {{0x458fd4cacb812f63ULL, 0xb621b604c1e70e6bULL, 0xb9c81234936186bcULL, 0x25b56b02373893dcULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x9410afb486971772ULL, 0x4663a36c4b023434ULL, 0xf966ebd980caba7bULL, 0x249b0bfa4f5864feULL}},
+            {{0xfb6d84e594bcc5f5ULL, 0x1eafd92f066eb268ULL, 0xd97636e1a8216d9eULL, 0x06ee132071d1c9edULL}}
+        },
+        .v = {
+            {{0x151eec69b002953bULL, 0x26ad4dd199f54b55ULL, 0x0e47056742d27b40ULL, 0x07d24fe060ddedfdULL}},
+            {{0x0d4c0fb49d196dcbULL, 0x97c7e4d2a70fa528ULL, 0x8172b854a4fc0aa0ULL, 0x1f91ee85be86cb1dULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x328810ec5967230aULL, 0x071ff07a00cfa07fULL, 0x3a4aae5f091e1784ULL, 0x1cd8a114fb22fe32ULL}},
+            {{0x950adf7cc458ec19ULL, 0xf7e99f13a06f6cfeULL, 0xc2fe03eeed05bd4aULL, 0x00addcd4fbb13f39ULL}}
+        },
+        .v = {
+            {{0x7832bca0b2ce336eULL, 0xf9dec9674c121886ULL, 0x78b031fc03d660f4ULL, 0x1d47a0c1987ebfb9ULL}},
+            {{0xc26f0bf07e676d95ULL, 0xf9bb7a8bd20938a5ULL, 0x0fc924066fce160eULL, 0x2f07b7f439694f2dULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x2e08f2f3984bd7f7ULL, 0x45350b10a131e6f4ULL, 0x38b3b47c22c6dd23ULL, 0x2932bf46a953f544ULL}},
+            {{0x951f1df5a04d8e27ULL, 0x8d3d75323b84df0aULL, 0xe44930a7627477d0ULL, 0x26c99c5a55c23d23ULL}}
+        },
+        .v = {
+            {{0xb52b2dd8a31f9900ULL, 0xb2ffa893d00d3011ULL, 0x94e66cc4169d8916ULL, 0x0314a27e39266f19ULL}},
+            {{0xb1680802fef87c43ULL, 0x53c9b971cffaf048ULL, 0x2d5876c469e2f50fULL, 0x05d20afac1e37bbeULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0xd2aed6fe1402a35cULL, 0xbfa899251e9d908aULL, 0x7935916a8e9903c8ULL, 0x0c849e97748af004ULL}},
+            {{0xf472ba05a7d6f1e4ULL, 0x7619673f34cc874eULL, 0x219faabd8301903bULL, 0x0bc1226657904288ULL}}
+        },
+        .v = {
+            {{0x4d853934eaf5a497ULL, 0xf77c9c6f1b37047bULL, 0xde25e05ae4a428b9ULL, 0x07d8f3e9e5286720ULL}},
+            {{0x2a4f65866556d5faULL, 0xf97e91dad13ffff4ULL, 0x2d34808447ffd7d3ULL, 0x14ffaf0c70bdf8b2ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0xf375de903f5334daULL, 0x47a9a24daa0b9092ULL, 0x7c12a8f4531ac37aULL, 0x1830114a8253c421ULL}},
+            {{0x6f1c80bb11e33976ULL, 0x8dc32aa548f1c345ULL, 0xbe3efbf0b54c6393ULL, 0x0430b5623d325365ULL}}
+        },
+        .v = {
+            {{0x7398dd37d3906360ULL, 0x08f9e8b97bf25aebULL, 0x6c273993f207e428ULL, 0x0ea5c2d8b3a16c7aULL}},
+            {{0xeaa607a9180b8e9fULL, 0x4cae0e897848b97fULL, 0x1daecb901dae2647ULL, 0x18c23eb642145662ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0xe683b7d17fb306c3ULL, 0x64e751cef41f1509ULL, 0x91e3b07ea5291d58ULL, 0x2353a0a1864efadcULL}},
+            {{0x029089698471fe02ULL, 0x99aae6d5d5a0100aULL, 0x4d8d98eb2920c337ULL, 0x07c6ad7da979ec68ULL}}
+        },
+        .v = {
+            {{0xbe298493183bb47dULL, 0xd85a1cab0860a6f9ULL, 0x76551fa69097e6c9ULL, 0x1f42b7c1bd1e9bc8ULL}},
+            {{0x3bd6b53ee0c9f276ULL, 0x660468ebdd606adfULL, 0x10003d7db4bf21b0ULL, 0x27e0d4d01efd6571ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0xf56de85410ed36f0ULL, 0x53eb40bb1b5814e5ULL, 0x798c3957d8b9c180ULL, 0x2578aaa8574b646dULL}},
+            {{0x066ce965d610bbb7ULL, 0x5a1e691f348c52a1ULL, 0x6980107bd030359eULL, 0x0f7747db4dd90e81ULL}}
+        },
+        .v = {
+            {{0xcf1a8cf25aac22dcULL, 0xf23dbc7f2ae05cd5ULL, 0x4b27f05a20bb0bc4ULL, 0x2f98565c72df6aabULL}},
+            {{0x605a4883d592c831ULL, 0x098954005ca1aa6eULL, 0x16add3467bc5c216ULL, 0x19972f5cc29595c8ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0xd336597e1bc8f3aeULL, 0x169b1a98c30915b3ULL, 0x99281588c2761678ULL, 0x02e421a47da35575ULL}},
+            {{0xd6bb46a14a1c8489ULL, 0x31ce432408ea1024ULL, 0xfd8c83b6c092fc69ULL, 0x1be2c951ca064d0cULL}}
+        },
+        .v = {
+            {{0x443ffd1cd7ab5115ULL, 0xea52fff9871ebef1ULL, 0x1c31abfc0e21d089ULL, 0x1e279c74ad11508dULL}},
+            {{0x61af652a1111ec5dULL, 0xb9555e2ef20c05c9ULL, 0x73882ff44a48d34bULL, 0x0a221d80415e7c2bULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x204b20720a6b364aULL, 0x894d7e6bd63ffa9dULL, 0x89863891707faa5fULL, 0x11fbc8db31303595ULL}},
+            {{0x12dcb1c387015a72ULL, 0x5b54d1ecb460a201ULL, 0x0baa39a96d3c49bfULL, 0x217fae26d45aa924ULL}}
+        },
+        .v = {
+            {{0x219caed3d5306393ULL, 0x5e317ca798360f51ULL, 0x9ca06be5e47902dcULL, 0x0d0032da69ba5590ULL}},
+            {{0xb8fbd22b0a3369f2ULL, 0x61181197f9f7c02dULL, 0x488e00b93f7e8772ULL, 0x0156d562da9da235ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x1ed5b29a0f1f7e5aULL, 0x334da58e315f9d95ULL, 0x40bfbc3ba2e9ba64ULL, 0x244b3e7c103650e0ULL}},
+            {{0x5698296f450d26e2ULL, 0x5a8c6cb5bc353f38ULL, 0x0af0c14f4df9fff7ULL, 0x20361e0b37e18f21ULL}}
+        },
+        .v = {
+            {{0x6f9dc7404614ae60ULL, 0xa0d9aca20cf2ef4fULL, 0x81f812d15dcdd724ULL, 0x0e4b5327aec38214ULL}},
+            {{0xb3a4e98bc72db240ULL, 0x682ed10265db3f81ULL, 0x1a51f2784a77296eULL, 0x2ce065f8235b32d6ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x8a498800a46d72a5ULL, 0xf8876757d397fb42ULL, 0x726e80af5855d00cULL, 0x2b4824d8f43f8e4bULL}},
+            {{0x1df9a0a42af053adULL, 0xdbe3bb2f5878c5d7ULL, 0xfc78dfa41c595d6fULL, 0x0fd46a2425e7a39bULL}}
+        },
+        .v = {
+            {{0x7040cf2468b8c950ULL, 0x5c2a2f4ab165c754ULL, 0xa1211cf4ad0a81b8ULL, 0x28927d64f2a18294ULL}},
+            {{0x7bfcfcf808943d05ULL, 0x7e9e6b2b951d208fULL, 0x036e31a2bedbcf95ULL, 0x11127385a99e98afULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x24acb43dc069cfaeULL, 0x95780ccb3880bc8eULL, 0xc234aa468b7155f9ULL, 0x11c3f6e3b05ac3f7ULL}},
+            {{0xd575d865a3055a24ULL, 0x848bf930d99c6f87ULL, 0x2199ee3467b12694ULL, 0x1a608fa91d48f0e8ULL}}
+        },
+        .v = {
+            {{0xf891e5ba9c6c460eULL, 0x0e84a16990ca35f4ULL, 0x612ff3689e8a509dULL, 0x2efe1fae6cbc204aULL}},
+            {{0x5116804b751b9f9bULL, 0xd3a85de1392c9bc6ULL, 0xe47933dca7024433ULL, 0x1dc97186995511feULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x0d200708e2847c3dULL, 0xe11b22713d29ff41ULL, 0xb3c27b912f08353bULL, 0x1ad4790502b2e910ULL}},
+            {{0x5ffea0c86c0b09cdULL, 0xbc5dab14d1146f9eULL, 0xfd5839f99db5197eULL, 0x024873da6d49635eULL}}
+        },
+        .v = {
+            {{0x29aeb396930f48d4ULL, 0xcb53f09fd221546aULL, 0x4379c15c2a00a81fULL, 0x0d5935169065e3baULL}},
+            {{0xe5097a31e098372bULL, 0xf780c57d5b4fec42ULL, 0x76970974d31ae2c0ULL, 0x0b626a0a00d1ca67ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x549c5a33b1dece0bULL, 0x463d21cf0fba4598ULL, 0x9c05cd82ab7f7184ULL, 0x18623d3304193ea2ULL}},
+            {{0x013a6fe9ec247e2cULL, 0xaa75b8a04fac43a2ULL, 0x43c961ac2e806fa2ULL, 0x28e5523c8be3fa5bULL}}
+        },
+        .v = {
+            {{0x774b3d24e699a2dcULL, 0xfac5be366a8b868cULL, 0x6df06055eb0a609eULL, 0x158c2e93137cfc6aULL}},
+            {{0xbeab3c7a02cac5b8ULL, 0x44c208f89177300cULL, 0x7d3a8331115752b4ULL, 0x28f50fc832af04f8ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0xabb33b6d34cc0a9dULL, 0x85d7f09a2cffbf8bULL, 0x5bbcdfee510bf7a0ULL, 0x2ea44a4de8530365ULL}},
+            {{0xbffb007b99e32e59ULL, 0x330c3302a3b0808dULL, 0xbf591a857888b7dbULL, 0x189fbbcb051654aeULL}}
+        },
+        .v = {
+            {{0x39927e32bd9a8b54ULL, 0xf8a9ec86ff0b1b95ULL, 0x7ed1c7f042bf53f2ULL, 0x0b6d2cc5d5a92afaULL}},
+            {{0xa17b2574de4ca010ULL, 0x0ab2aeaf2528c78dULL, 0xf01f84c7065b0526ULL, 0x01e6f6456eeabe7eULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x39373312b9cee464ULL, 0x4fb640af897092aeULL, 0xf4c85c53a5ee031aULL, 0x2adbf75bda626335ULL}},
+            {{0x798e74acac1d1fc5ULL, 0xeabb61a4fc4d15c8ULL, 0x25ff8606ac633acbULL, 0x2e2f6b36d56f2e58ULL}}
+        },
+        .v = {
+            {{0x21775979ed1d9614ULL, 0xeabb3a6fd6c8104eULL, 0xec143d6c7f88489aULL, 0x2ac2833d00fa3389ULL}},
+            {{0x896513f3fe2e5a41ULL, 0x1efcf8f847156e00ULL, 0xf12081a9d6ff9413ULL, 0x209acf2aa8b6b190ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x9374562cd7ccd232ULL, 0x0bf4fb656ce84d9fULL, 0x2e620625f6c54d0aULL, 0x1b80ded3bfbdb053ULL}},
+            {{0x6149c6e082a396a1ULL, 0x40ad1446e4285244ULL, 0xdf4619d58a8b8c68ULL, 0x11c96afb66520545ULL}}
+        },
+        .v = {
+            {{0xbf4707d559ca3d9bULL, 0x0e20c99d3d42cf92ULL, 0x41c06e74a87c26b1ULL, 0x0f8d1261d39f2a45ULL}},
+            {{0xc2fa6a4d9b01ce48ULL, 0x12bda05b39f8e1b8ULL, 0x2cc6b05ad9cf0af4ULL, 0x0fccf77e4a4efb27ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0xe8e381f8ac772a5fULL, 0x9e9b8f88d7dfeee8ULL, 0x8ca555576fcaae93ULL, 0x25db182a18edae99ULL}},
+            {{0x22850ff6d6d9315eULL, 0x08b250b6ab3cbfe1ULL, 0x9b348c88f855444fULL, 0x1f108bf60c08fdefULL}}
+        },
+        .v = {
+            {{0xa15576826459b752ULL, 0x40c6ac412e9336a9ULL, 0x771142bcd577006aULL, 0x2269239cd7e291faULL}},
+            {{0x17e1f28ced08e38dULL, 0xfd57c81ef208ae5cULL, 0x8cc1da9251aa8884ULL, 0x14c725219e6f089dULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x8728852199c5f0d8ULL, 0xf9bc6f9a75dbca2cULL, 0x59b2b1aec193756cULL, 0x199b704fba0352cfULL}},
+            {{0xbf912a8d41adce5cULL, 0x28af839cb942126bULL, 0x4eae53aaf5ba6753ULL, 0x22d40c096c45cfdbULL}}
+        },
+        .v = {
+            {{0x3916a180f2440e87ULL, 0x9d1b61a09c6cdde7ULL, 0xa22f5b9db69ef866ULL, 0x25901f8a7ac2c7b2ULL}},
+            {{0xd8428f36415803d0ULL, 0xf27622bb5c445fe5ULL, 0xeedec6e6d9ef523aULL, 0x2c450aa3d37ad1e0ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0xdadca0356162ee50ULL, 0xa97a1f05c5cac1b4ULL, 0xef63b46b33140136ULL, 0x18823b7aa1a258a0ULL}},
+            {{0x4d16d887277bf4a0ULL, 0x6ef1d5042b3fb612ULL, 0x3e8e15a77a7db0dfULL, 0x14213946ba0a53b9ULL}}
+        },
+        .v = {
+            {{0xb6449cdb02032549ULL, 0xc8f21d4bdb4bfacbULL, 0x7b08bf92d978528eULL, 0x3052c81b10586a6cULL}},
+            {{0x74e2594861b2e00aULL, 0xe76a42dfcb52e624ULL, 0xaa659e948301f45dULL, 0x02b34b274bd311c4ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x9a76b8b59e3ef906ULL, 0x4f5064374bdfd0fcULL, 0x8a7cd0c0a4734f95ULL, 0x0dd61c9fd30d5157ULL}},
+            {{0x666c1582f3e865e4ULL, 0xe48221d856b82c97ULL, 0x5f13219405a2ac5aULL, 0x0e8303e00c19280dULL}}
+        },
+        .v = {
+            {{0xa191b0c6d536c5d0ULL, 0x22cd1dec57cac6f9ULL, 0x1e015346e6fe9572ULL, 0x2610e2c82270bc59ULL}},
+            {{0xa396ed81d0b00bbfULL, 0x01277306fcdc38cdULL, 0x8a1af286700da8d0ULL, 0x245af7b2a8f24519ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x9682969124f02dc8ULL, 0xe35d11070ca11b2eULL, 0x9374e06e56fb24abULL, 0x21fc3ef53d9c6032ULL}},
+            {{0x61926e4dc2338f96ULL, 0x6eb91e4135d1bbefULL, 0xf846ea2fc7dd8f87ULL, 0x0dbe109a8c366b32ULL}}
+        },
+        .v = {
+            {{0xddb5064dbbae4fbfULL, 0xa1743f1e668044c0ULL, 0xd08762d01a3a8569ULL, 0x12df29a57d950be1ULL}},
+            {{0x9c0113a7a8790a76ULL, 0xd84e141efc53f97eULL, 0x31eaeb1e1d9b7b9fULL, 0x27a770300059d7d1ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0xf5f04c878e7a06acULL, 0x0309e49b19d05e6aULL, 0x2f2091755d83186aULL, 0x0366c8ff32caf82bULL}},
+            {{0x7cc4b5de9667e4b8ULL, 0x6a913e5c30c1dbe8ULL, 0xa1dbaa7e307bea6eULL, 0x3003deff0207f429ULL}}
+        },
+        .v = {
+            {{0x9a5b7c98f5a62534ULL, 0x29b50fd87219e883ULL, 0x051de4333297ecceULL, 0x2eca40b887a18ba9ULL}},
+            {{0x16a30e41d2be5717ULL, 0x9d8f55d5355bf75dULL, 0xde93143183b53030ULL, 0x28ca51fa4c897578ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0xea84b2d9a932145bULL, 0xd425e87e107a8afbULL, 0xfda2a713962b0313ULL, 0x1942d6229f4c8d9dULL}},
+            {{0xa3b3e3a3c92ddb36ULL, 0x499d7707276c8b2bULL, 0x582bda568982389eULL, 0x18dd0c1233567e0aULL}}
+        },
+        .v = {
+            {{0x7b39d252c73ff464ULL, 0x28b483729a960250ULL, 0x458abb02330fbe36ULL, 0x2fe39a911f1f8c88ULL}},
+            {{0x4a1aefb149e1f788ULL, 0x5033e7e379e4bdb0ULL, 0x6c72c9892500f642ULL, 0x1a59698f522e7d0fULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x375aec4b34240f40ULL, 0x84fe361dcce18ff9ULL, 0x51213476cf880498ULL, 0x166d1bd9baeee969ULL}},
+            {{0x3d4528cabed4ff46ULL, 0xdf7f939e40825f32ULL, 0xab92e9307dfc6e52ULL, 0x2616c2f0d156996fULL}}
+        },
+        .v = {
+            {{0xa79f53ccc835f150ULL, 0x6e5689cbca018dffULL, 0x099ed60fe5fda498ULL, 0x150c4e4c9c5c6482ULL}},
+            {{0x7f444d7e6d758cb4ULL, 0x994a38f98f658536ULL, 0x5d5842a14db7e2a0ULL, 0x2f26540bd1413ac4ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0xffc4746e60b17703ULL, 0xa54bbaf836f6c44fULL, 0x063ae6e14d4251fbULL, 0x063db8164b30633dULL}},
+            {{0xb8affd5650ef1528ULL, 0xf78e1832c3c7ea8cULL, 0x8496e26a992d35c5ULL, 0x17b8712d7ce05913ULL}}
+        },
+        .v = {
+            {{0xf2a3c36c6af152dfULL, 0xbbbe2fee41b34c41ULL, 0x378eb7356e476e12ULL, 0x060725c6dbfc87b7ULL}},
+            {{0x9ce7109c3cc18984ULL, 0xebb067ffa7a5658aULL, 0xb0466bd4858d10d6ULL, 0x0043a52c07ddaaafULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x0e5834c1758a2b3fULL, 0x16b89ed2ed1ecfe9ULL, 0x4e622013e1d79dedULL, 0x2b215e94b0b7611fULL}},
+            {{0x64f219ade72a7b25ULL, 0x00691a50229cbfdbULL, 0xf1146dd1b2c93b7dULL, 0x2d0a47f1690b7b73ULL}}
+        },
+        .v = {
+            {{0xe78c0065c3fb944eULL, 0x15339bf86e07326bULL, 0x78e463e23920c204ULL, 0x29310cb94c518a22ULL}},
+            {{0x803aa8ec9aea3b78ULL, 0xd6913fa56c0744b7ULL, 0xb53cb583ec7a8bc0ULL, 0x240987e193f950c6ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x9b2c79aa75321480ULL, 0xdc1b94dd0df0bafaULL, 0xa6f36d3de9de73a9ULL, 0x2fb523ccac328504ULL}},
+            {{0x7f8e99b24839b551ULL, 0x7e0dc3d21b4416e5ULL, 0x8b6726a155af743dULL, 0x083da95b3837dd59ULL}}
+        },
+        .v = {
+            {{0xf41931259675fd3bULL, 0xe337734f9b4ef05aULL, 0xc6cb78e44d212cf3ULL, 0x005aef6b72131cf0ULL}},
+            {{0x04292caeb6cdd054ULL, 0xf9f2f81edb8370fcULL, 0x6eacbd95ce55195aULL, 0x166a10b52b4b5a41ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0xbd4e406ab0c2be46ULL, 0xfd0b7ccbf69f8b4bULL, 0xd0679ec419cffa3cULL, 0x167e6846e633827eULL}},
+            {{0x68be0fc83c808fb0ULL, 0x9264768a64899ef6ULL, 0xcb2e02a48c0fef73ULL, 0x021138211ac939b5ULL}}
+        },
+        .v = {
+            {{0x0e5741b0ede55bc4ULL, 0xfd6ac51eff54e57bULL, 0x60f49a567ab23988ULL, 0x2a96b88e0b00a46fULL}},
+            {{0x77e6eb0a778737fbULL, 0xd7c3e7097f6a2ccbULL, 0x68504002c817cadaULL, 0x28bd3fbd087aca02ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x537b9fa347dd4b57ULL, 0xc2b6ef32a4ddd27eULL, 0x8fc0e97ed422d87dULL, 0x00c4caad6030c9e2ULL}},
+            {{0x5df784a9f54cae34ULL, 0x6657de422e981a7fULL, 0xd15c9794f76830edULL, 0x12be7a6d85954c81ULL}}
+        },
+        .v = {
+            {{0xc393f0903f1d68ccULL, 0x26cac39e36f65da9ULL, 0x0d9769b861734d59ULL, 0x0233d0b16ed4a0ffULL}},
+            {{0xda1eefebe09d2c48ULL, 0xb4914a5e7f5fa14eULL, 0xefcbf0720b2136d6ULL, 0x25659e15d6ed9189ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0xdb8b9c3c8acd0997ULL, 0xa186efe1d9c50fefULL, 0xb2e1eae1adb21c53ULL, 0x1c73dd0a530613c9ULL}},
+            {{0xee8510fc6cd58804ULL, 0x76fd172c7c1e1bf3ULL, 0x0eba68e945e8a159ULL, 0x1bf9f7d1f9d544c0ULL}}
+        },
+        .v = {
+            {{0xf5fea4e8dc0d6c34ULL, 0xaf754aee48a4a5a8ULL, 0xd84225970bf458b7ULL, 0x01073da1327851baULL}},
+            {{0xf9c21e613d22460dULL, 0x74be9b1544d7db65ULL, 0xf2793d351c6ae987ULL, 0x1603c135970fe460ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x1dd00a059e03af1cULL, 0xe34cc4924720f4caULL, 0xbd99df9ed8eb9d91ULL, 0x297a2c6017b18aacULL}},
+            {{0x9c1480c99d03ebb5ULL, 0x6f8bb8ef6b7b2504ULL, 0xd25cd6bd3b44ad39ULL, 0x28484df5dc5dab6eULL}}
+        },
+        .v = {
+            {{0xeee1403e66b1a65fULL, 0xd508a78cadb109e1ULL, 0x1ab864995c5b4597ULL, 0x1fe72ddc1164f396ULL}},
+            {{0x4a1910491583c09eULL, 0x4bb56bdd4883ada5ULL, 0x64511a842c6f5cdeULL, 0x19ecb6ccdea28367ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x8feaeb01c475fdfeULL, 0x0b38e7069843036bULL, 0x62b1aa7157ae14b6ULL, 0x015b478c1e9140d8ULL}},
+            {{0x124dda5710aef380ULL, 0x1695443714399c43ULL, 0x8e93d4a879080597ULL, 0x2d165f8862968e43ULL}}
+        },
+        .v = {
+            {{0x2f1de0e6a6f377fbULL, 0x2deb91b1cbf9aeb3ULL, 0xf5aa270582c44fb0ULL, 0x135762cf0d9567a9ULL}},
+            {{0x06dc64f2437a6b03ULL, 0x1291b9eec72256aeULL, 0xa5ddebeb1d811e75ULL, 0x19009d8ce4ec22e9ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0xfd6bb236c489f798ULL, 0x2f112a67be6eecd7ULL, 0x313f39e1013da4b0ULL, 0x06c72d114d0a53b2ULL}},
+            {{0xebdaec55a42bfe2aULL, 0xd1914ab1089f31a3ULL, 0xc2220bf681ab813bULL, 0x167b5e8b43206d53ULL}}
+        },
+        .v = {
+            {{0xcd9e27aa84e27cbaULL, 0x75b69ef2b8c3b0e1ULL, 0xd482898907011e4fULL, 0x042fb00bcfccd843ULL}},
+            {{0x01142a6cdef24056ULL, 0x57069beba8f53487ULL, 0x3d47c095898f784cULL, 0x10df809eabbbffecULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x4c728785995802fbULL, 0x6ebb2d44f123d1ecULL, 0x133800d11d2d6364ULL, 0x16e5b4328a98bbe1ULL}},
+            {{0xf4b5ef566e3867b5ULL, 0xc554032fb2160ba9ULL, 0x491d7098c0926733ULL, 0x1614b29f533ae983ULL}}
+        },
+        .v = {
+            {{0x4005cc6215fe09faULL, 0x65a28f22fe02dcd7ULL, 0xea99c0fb6052b5a4ULL, 0x233a7917926918adULL}},
+            {{0x80329fba38685b7eULL, 0x72e769016bdbb169ULL, 0xd84ec0b7f0976808ULL, 0x02f5e04c47a5b2a6ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x4ce3ccaf6e72256eULL, 0x86a562395d023349ULL, 0x264808c67f8fe75fULL, 0x1649745b0ed8ecc0ULL}},
+            {{0x905eaecc44376f96ULL, 0x95295fd20151a678ULL, 0xf67d5e923014fbe2ULL, 0x03826ae1542a81f1ULL}}
+        },
+        .v = {
+            {{0x9d44a3bf37c04c05ULL, 0x22848b191d36d1abULL, 0x86681902dc517579ULL, 0x19361bb18e3fa297ULL}},
+            {{0x7295993595aae022ULL, 0x1d6bce931f1fa7e6ULL, 0x5b06c30d7a316b92ULL, 0x00a373bc6409817dULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x4e6a8321cd55127bULL, 0x47ce53b89e2837fbULL, 0x57666cc6c1d8f6caULL, 0x070e55e2366b29d4ULL}},
+            {{0x1497ce503b1904e2ULL, 0xfc3d760407e05229ULL, 0x3deeb57af0664e7bULL, 0x27d327949a04cbd7ULL}}
+        },
+        .v = {
+            {{0xaf2f890e92d29f20ULL, 0xd2eaeb75b085501eULL, 0xb637e724df2f4d07ULL, 0x2c1facab4f716272ULL}},
+            {{0xe7456950bb4fb982ULL, 0xffc87d22768ec748ULL, 0x044806b95c14a74bULL, 0x1da00a71afd1c6abULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x928ae51155802bdfULL, 0xbbe87b8629459d85ULL, 0xf7d1582afab000aeULL, 0x0430e290f9cfbd1dULL}},
+            {{0x91f1d4df2ed39339ULL, 0xf93c4b315fbf7da7ULL, 0xed3a2bed2fa82d0bULL, 0x0efba6975a3734deULL}}
+        },
+        .v = {
+            {{0x96947b87bba4ec19ULL, 0xa0946443fc49ebe9ULL, 0x15e3faf2b5a79633ULL, 0x10a935a376a036a5ULL}},
+            {{0x6a33bd4bc9410032ULL, 0x32a38466cd418f41ULL, 0xf1b6f5cab62eba50ULL, 0x161dcf8020331c70ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0xec376b81242228e5ULL, 0x7737e8263bada07eULL, 0x11c0a5d9a45618a3ULL, 0x28d9428fe23cc79aULL}},
+            {{0xf4d09c0536eeb6c7ULL, 0x4f404d395afd60afULL, 0xe8b040bd7ded2f14ULL, 0x0922a14761760e85ULL}}
+        },
+        .v = {
+            {{0xfff25b417c992283ULL, 0xbe04dd773f3ee79eULL, 0x849db45408739147ULL, 0x08f110059623528fULL}},
+            {{0x79209ab23938dbc0ULL, 0x9d0ffa7c73fc80c5ULL, 0x6a6ee502b7cd8227ULL, 0x1db695fbc97d5aafULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x649e2498a4473290ULL, 0xe0c92a9a39f67014ULL, 0xd309276b67247ebcULL, 0x2c70148593e02586ULL}},
+            {{0x285762ae054b1cf8ULL, 0x928dd6043f284419ULL, 0x63f460f9e9bc90c0ULL, 0x0d554d6b739cf533ULL}}
+        },
+        .v = {
+            {{0x7affbcc767c605aaULL, 0x3b122f9a6102c711ULL, 0x086587d97f285061ULL, 0x1b7763379209a312ULL}},
+            {{0x5bbd354ed9575db3ULL, 0x73b23ae3e3221400ULL, 0xf64ea5bd42eb67d2ULL, 0x2940c195a7e8ed16ULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x75adeb09111a79d2ULL, 0xc8a80fc630284645ULL, 0x0d383241baeaf15aULL, 0x2d6cee1f06f6c6afULL}},
+            {{0xa95f1dd58253e887ULL, 0x5fbf52d9f3efa8b7ULL, 0xf16f4a66e55ed5a1ULL, 0x0ac9528d25181134ULL}}
+        },
+        .v = {
+            {{0xa2f25854396901bfULL, 0xb37ecf6b9d2ff65fULL, 0x121929775a13dbe0ULL, 0x1e3709c67ae7b80dULL}},
+            {{0x9faa65d0a2f680a5ULL, 0x5fbb4bd81ec89881ULL, 0x56bb96be6bc55372ULL, 0x0c305c60c92fb4fcULL}}
+        }
+    },
+    {
+        .w = {
+            {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+            {{0x91b1fb2dec2060a9ULL, 0xbb1699878ee7ed0bULL, 0x9eb2ed0743f91f18ULL, 0x184681152ffe8715ULL}},
+            {{0x4d4f25e7083f6c29ULL, 0xf14b6134d6c51f9dULL, 0x059c836270299e0fULL, 0x2d199eaad4ef0e1fULL}}
+        },
+        .v = {
+            {{0xf181a86802370281ULL, 0x777a95a8d9b7126aULL, 0x764072f4639da260ULL, 0x0a0559d13742d02bULL}},
+            {{0xdddd524f78abaed1ULL, 0x30874d87b94bea50ULL, 0x22c142fc9bcf74dfULL, 0x08af2e8d1516d777ULL}}
+        }
+    }
+};
+
+/* Dense matrix of the last partial round */
+static const _Alignas(CACHE_LINE_SIZE) field_t POSEIDON_MDS_LAST[3][3] = {
+    {
+        {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
+        {{0x1a89b03fd4cda82cULL, 0xb25910dad7b3fa63ULL, 0x8f19ec56381eb4a2ULL, 0x2a5a9c822ddbfb29ULL}},
+        {{0x63e9b4772b82f9c9ULL, 0xc8b1aa828507d6b3ULL, 0x4ff4d6e0e6ce76d7ULL, 0x2b90f5b1225c9161ULL}}
+    },
+    {
+        {{0x2e2419f9ec02ec39ULL, 0x85045b68181585d9ULL, 0x30644e72e131a029ULL, 0x0000000000000001ULL}},
+        {{0x9f743e1ca463cc1fULL, 0xd9883d246065c8b1ULL, 0x62ba3605b30de6efULL, 0x17342a0949b45e7eULL}},
+        {{0x6eb383a215f0b666ULL, 0x12c8c8ba2ad630e7ULL, 0x80bbddff24ce7251ULL, 0x0f0feb5cbf086524ULL}}
+    },
+    {
+        {{0x3c208c16d87cfd46ULL, 0x97816a916871ca8dULL, 0xb85045b68181585dULL, 0x30644e72e131a029ULL}},
+        {{0x6eb383a215f0b666ULL, 0x12c8c8ba2ad630e7ULL, 0x80bbddff24ce7251ULL, 0x0f0feb5cbf086524ULL}},
+        {{0x750a178e8d30c9a9ULL, 0x54c1322b9d5fb7feULL, 0x74f77f434513e4aaULL, 0x0468f8069d266aa5ULL}}
+    }
+};
+
+#endif /* POSEIDON_TABLES_H */
@@ -0,0 +1,487 @@
+/*
+ * Poseidon tables for the IFMA lanes kernel
+ *
+ * Five 52-bit limbs per element, Montgomery form with R = 2^260
+ * (see field_ifma.h).
+ * Generated by tools/gen_poseidon_tables.c from poseidon_constants.h.
+ * Do not edit.
+ */
+
+#ifndef POSEIDON_TABLES_R52_H
+#define POSEIDON_TABLES_R52_H
+
+#include "poseidon_tables.h"
+#include <stdint.h>
+
+static const _Alignas(CACHE_LINE_SIZE) uint64_t POSEIDON_MDS_R52[3][3][5] = {
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x19f9ec02ec390ULL, 0x8181585d92e24ULL, 0x31a02985045b6ULL, 0x00130644e72e1ULL, 0x0000000000000ULL},
+        {0x08c16d87cfd37ULL, 0x916871ca8d3c2ULL, 0x181585d97816aULL, 0xa029b85045b68ULL, 0x030644e72e131ULL}
+    },
+    {
+        {0x19f9ec02ec390ULL, 0x8181585d92e24ULL, 0x31a02985045b6ULL, 0x00130644e72e1ULL, 0x0000000000000ULL},
+        {0x08c16d87cfd37ULL, 0x916871ca8d3c2ULL, 0x181585d97816aULL, 0xa029b85045b68ULL, 0x030644e72e131ULL},
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL}
+    },
+    {
+        {0x08c16d87cfd37ULL, 0x916871ca8d3c2ULL, 0x181585d97816aULL, 0xa029b85045b68ULL, 0x030644e72e131ULL},
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x19f9ec02ec390ULL, 0x8181585d92e24ULL, 0x31a02985045b6ULL, 0x00130644e72e1ULL, 0x0000000000000ULL}
+    }
+};
+
+static const _Alignas(CACHE_LINE_SIZE) uint64_t POSEIDON_FULL_RC_R52[8][3][5] = {
+    {
+        {0x81364662ca803ULL, 0x2aa9bb077a930ULL, 0xfdf640cf2faf9ULL, 0x4c89405604784ULL, 0x001e316c1e257ULL},
+        {0x70081bc772028ULL, 0x3f8a9794c5caaULL, 0x034dfed78be61ULL, 0xec7b7b8288289ULL, 0x01e0fe12eacfcULL},
+        {0x8b10065b491fcULL, 0x807fba14e5188ULL, 0x439a2dae19340ULL, 0xaeedaf24e5707ULL, 0x016a91d11f438ULL}
+    },
+    {
+        {0xfe6a02e7a4f42ULL, 0x888582a40f351ULL, 0x8253dcf321042ULL, 0x98805452da83eULL, 0x00672e4392523ULL},
+        {0x3fcb4d3434847ULL, 0x927f01a334337ULL, 0xceb3151c158feULL, 0x86d2517f5b197ULL, 0x01306ef667695ULL},
+        {0x8cdd20502355aULL, 0x5ce607577a4c7ULL, 0xc9aeadc5992edULL, 0x3855418c73489ULL, 0x004972504a0d7ULL}
+    },
+    {
+        {0x413a59e1dd8e5ULL, 0x5b2fda30fc935ULL, 0x66f0ec5227b64ULL, 0xeb4e68ae6adadULL, 0x02f4413d6fb98ULL},
+        {0x39920f4c072c8ULL, 0x6b95a887703a2ULL, 0x2d69fcbc03795ULL, 0xd275a0e18bff9ULL, 0x00560551f6386ULL},
+        {0x725cff0b7d278ULL, 0xbec57e4e1bd50ULL, 0x62444353fdce3ULL, 0x5ccc1eebbe8d1ULL, 0x02a232394b7daULL}
+    },
+    {
+        {0xef4c65cdca888ULL, 0x6b018a98eac41ULL, 0xc3356c0ee98f3ULL, 0x54606e8123a20ULL, 0x0010d41c8eee3ULL},
+        {0x67688bdddd204ULL, 0x2d264bbf1dafbULL, 0x49052aa3e2984ULL, 0x85b512610d59cULL, 0x003d78c6349a9ULL},
+        {0xd6b0a3af4a372ULL, 0xd9ebfa5cf6c37ULL, 0xd2b63b77c240bULL, 0xaf4eea03710d7ULL, 0x02ffa3814cca8ULL}
+    },
+    {
+        {0xf7959df9f0e16ULL, 0xa876214a7813aULL, 0x38253836dbb0dULL, 0xf50b9f89c77adULL, 0x00dc170ec6936ULL},
+        {0x843d93bf9262eULL, 0x3136d57d2d2e1ULL, 0x7c6f911a391a3ULL, 0x9269217dac265ULL, 0x00d5d6c7cdf02ULL},
+        {0x3d16dff28b256ULL, 0xb6767257ad94aULL, 0x9c65ce434aa48ULL, 0x61f9fc44fd4f2ULL, 0x029977b9e1b30ULL}
+    },
+    {
+        {0x6016d79296d97ULL, 0x9ec2878e93177ULL, 0x1c38d019589c3ULL, 0xed2551c1c5892ULL, 0x02b5a9f0e37aeULL},
+        {0x9a7cfb1ce819bULL, 0x7065f5310e8e5ULL, 0x5d623158c2f0cULL, 0xb62a2c5f690eeULL, 0x0187d620295f9ULL},
+        {0x799aa5bc305d2ULL, 0xeaccb99388368ULL, 0x27c89a2c91252ULL, 0x3d87d73735e02ULL, 0x016fc10d3e8a0ULL}
+    },
+    {
+        {0x666c858944d5cULL, 0x2ca290ee0c635ULL, 0x1e8719366a85bULL, 0x46770797537caULL, 0x01829fcae373fULL},
+        {0x8285ee7368b71ULL, 0x4e0ff9a5d3283ULL, 0xe5dfbb6722600ULL, 0xa377a8660e979ULL, 0x01e5eac1ad1dcULL},
+        {0x1c4a5c79e110cULL, 0x602932d2b9ef1ULL, 0x0d2c057487146ULL, 0xd43bf65fe55cfULL, 0x00b7202b81a02ULL}
+    },
+    {
+        {0x0e621521fd149ULL, 0x15ad4f9e2bed5ULL, 0xc50b447711ed3ULL, 0xa9a4e72a1fac2ULL, 0x019cdb7cf9fbdULL},
+        {0x9b6fe5b542e25ULL, 0xeb75f2954b5d8ULL, 0x30c9790086a99ULL, 0xc28bce8d1af9eULL, 0x02017a4549fdfULL},
+        {0x695f850e2c8f1ULL, 0x48f11a529a260ULL, 0x24d71a1c23fdcULL, 0x11d2ff8f4689fULL, 0x028e40d6fc1d6ULL}
+    }
+};
+
+static const _Alignas(CACHE_LINE_SIZE) uint64_t POSEIDON_PARTIAL_RC_R52[49][5] = {
+    {0x87a7a8dd6d83fULL, 0x3c72d0bf41432ULL, 0x5c7919935fcadULL, 0xa51b5cbdd0ebfULL, 0x029b647aaac69ULL},
+    {0x88471f0efe9f2ULL, 0xe3604d9ece735ULL, 0x66e892550bb7bULL, 0x6523572eeefbfULL, 0x0013df09f299fULL},
+    {0x0212652bec0cdULL, 0xfa37a29bf825eULL, 0xe38a04ef270d8ULL, 0xfba50d8c59643ULL, 0x02b22a3428c22ULL},
+    {0xe640a3cd1aa56ULL, 0x0722368b9bacdULL, 0x052635eadddc1ULL, 0xb267d5378acc0ULL, 0x028ba19bbf2a2ULL},
+    {0x4190a845123b7ULL, 0xe9836aec7b502ULL, 0x5fdaa75fae26aULL, 0xe9383e21a80c6ULL, 0x02c71de132fa1ULL},
+    {0x7ec9ba266c038ULL, 0xe018461590fc6ULL, 0xa1d6c916e2875ULL, 0x523c0b6595770ULL, 0x01053889f3a54ULL},
+    {0x6165d37b47eb6ULL, 0xb841b6c735bf2ULL, 0xeddbd7ccdbcf9ULL, 0x9bea4c3abb045ULL, 0x0111befc1907dULL},
+    {0xf3a8a966a0925ULL, 0x2a844ce1263b8ULL, 0x779564a84c244ULL, 0x2c4b67644b0dfULL, 0x023b006ed8e48ULL},
+    {0xf7502e6c00ae2ULL, 0xecd44a529abdbULL, 0xc870fbfa60170ULL, 0x5da2db4db3b68ULL, 0x0185b2d16bd1eULL},
+    {0xf7b8e658486deULL, 0x682da2f69e596ULL, 0x4fbffdeef587fULL, 0xe3f8570211f90ULL, 0x00a631fca77aeULL},
+    {0xcc0b4f608d055ULL, 0x537d17ccaf15bULL, 0xb9b79075d5f3fULL, 0x02ce6a8cfa609ULL, 0x00cd6a4540057ULL},
+    {0xf720e239aecd8ULL, 0x8dd2476343b69ULL, 0x83038866c9bd1ULL, 0xc69860698fd1aULL, 0x025d8bcc9d254ULL},
+    {0xf4d717f52660fULL, 0xc14c8192b51e5ULL, 0xd7b489fe57763ULL, 0xf518be572a947ULL, 0x01d872994c688ULL},
+    {0xed892d2ba9810ULL, 0x2e5156da73c33ULL, 0xab53353c6801bULL, 0xa5a8788dc0d56ULL, 0x024a0af87aaf1ULL},
+    {0xac6b364baecceULL, 0xaa78491fd7c73ULL, 0xe8c3b25cf6115ULL, 0xcd94c83448459ULL, 0x021894672e7b7ULL},
+    {0xdd5b3f84819b0ULL, 0x77caa82a2d403ULL, 0x1d17f31a72bb2ULL, 0xfb27558a8543dULL, 0x00aed46c0220eULL},
+    {0x8ffd0152a47c5ULL, 0x5077cea18bd69ULL, 0x7ce5289302802ULL, 0x4efc35298e68cULL, 0x015b4f026dc87ULL},
+    {0x6bc4c9cbdc2cbULL, 0x5c947792f5589ULL, 0x308d3eac034d7ULL, 0x841dd73202f69ULL, 0x02a69a6f1ff60ULL},
+    {0x45bbe7e3e8ef7ULL, 0xdbe512ceec820ULL, 0xbb30539b5bad3ULL, 0x7d072bd750368ULL, 0x004e0e26ab437ULL},
+    {0xc848f5b4a44c4ULL, 0x4ac415ced3c59ULL, 0x51317e83a0ecdULL, 0xd59e8b399f92dULL, 0x0074daf8c11c2ULL},
+    {0xf9be826ab2345ULL, 0x2cc55bacbf78bULL, 0x07d18819fce4cULL, 0xd437aaa943c11ULL, 0x0290f7e1e4746ULL},
+    {0x7a6235ab41a8aULL, 0xa8f5c39827f76ULL, 0x19f59d1a38563ULL, 0x1c56c51be99daULL, 0x01a54cf8a266bULL},
+    {0x8ce5ccf772c8cULL, 0x26f1e05909cf0ULL, 0xb176d41dc99d2ULL, 0x1801a691666b3ULL, 0x00e25b2935fabULL},
+    {0xb7e9b6022b947ULL, 0x794bbc8548656ULL, 0x2c4035b35b69fULL, 0x65577dc13d517ULL, 0x00d51cdcff09aULL},
+    {0x52a89e37ca75fULL, 0x882eadd18882dULL, 0x0068bbe43f5bfULL, 0xa3a048bcadd4dULL, 0x0020329030ffaULL},
+    {0x40de88b369045ULL, 0x10ba682e37acdULL, 0x60a26b33cff85ULL, 0x01b2b3c8570b8ULL, 0x0037f28fdf70eULL},
+    {0x84d77af7b765aULL, 0xf6ef517e4f205ULL, 0xb8ce5d793d29cULL, 0x3f2371020a57dULL, 0x004618d2cc295ULL},
+    {0x3efc8303917baULL, 0x3ef639329f37cULL, 0x9e2310459980eULL, 0x6e8ca6e67b683ULL, 0x02fd8dec3ce60ULL},
+    {0xb07e69845a85fULL, 0xed2c114d94fadULL, 0x6f0f1ed48c259ULL, 0xf610f7d86ba03ULL, 0x014c4c895b14eULL},
+    {0xe3691f3eee491ULL, 0xb26fb17f5919aULL, 0x307b2cc57f2d2ULL, 0x6e0d2b34f5242ULL, 0x00950ded080feULL},
+    {0xbf2f5566964f7ULL, 0xabeb85ba75f4fULL, 0x8a2384f5ebeecULL, 0x16d2d385c2391ULL, 0x01e7f9495c5e2ULL},
+    {0x7d1e5543a581fULL, 0x6330f338ee9b2ULL, 0x9f0252e326f6aULL, 0xd64ab141f8a2eULL, 0x02255e22c5e3fULL},
+    {0xa955ed87fe8c0ULL, 0x4bc6b8eb99ddcULL, 0x6c5849ce1c4daULL, 0xaeee075731802ULL, 0x01e9b3bcc192cULL},
+    {0x9386bd49d8543ULL, 0xffcc12e095993ULL, 0x51350c6e25ba6ULL, 0x7bd618cfcc4b0ULL, 0x01afb13509da3ULL},
+    {0x904213628e970ULL, 0xc9fceb1842378ULL, 0x8ae36af2c2995ULL, 0x3a70cabbc6e09ULL, 0x006800ee2bb64ULL},
+    {0x58bd9bb2d9e38ULL, 0x3292387f26ac0ULL, 0x2856208e7591dULL, 0x2d05d918fda40ULL, 0x02b519851bcf0ULL},
+    {0x1ca84f513063bULL, 0x61f57d89fc9b8ULL, 0xc307918f1ae0dULL, 0x3060d287edb72ULL, 0x023575f49db60ULL},
+    {0x2a2646312d2ecULL, 0x76f880da6b227ULL, 0xc2530f6558a41ULL, 0x67933a946946fULL, 0x0047ee93f9e80ULL},
+    {0xef06d210c2c5fULL, 0xae93719b4df12ULL, 0x3673ceaa92f52ULL, 0x11b3804e459ccULL, 0x011a91882b38aULL},
+    {0x39d263de184b2ULL, 0x096c39ab231d9ULL, 0xc6b72da05fffeULL, 0x0bf18a2f4a3f9ULL, 0x0179cb4525f65ULL},
+    {0xeeb4872d34630ULL, 0xd0bd013d91601ULL, 0xbe71b34083275ULL, 0xfec2499a5a31dULL, 0x00a0e19db31cbULL},
+    {0x9fc8e610dbee5ULL, 0xf051b3f6816e8ULL, 0xb339517f38252ULL, 0x29d4df4f317f3ULL, 0x019425bf5b8bbULL},
+    {0xfcf16638eabc4ULL, 0xf24dab46000aeULL, 0x9ce49a88d0b11ULL, 0x2f336b3a9c8bfULL, 0x02f97a08d3e7fULL},
+    {0xf5e6ae783c924ULL, 0x7bc20190c25a2ULL, 0x9ec52825d38bcULL, 0xefdb96806bf16ULL, 0x00e5bbf4b91beULL},
+    {0x1af6b7a1fc033ULL, 0x83b4ac4363b58ULL, 0x0c901dccf608cULL, 0x7c6f9891223c4ULL, 0x024fc82329631ULL},
+    {0x74354ec39ca23ULL, 0xa2987278bd0feULL, 0x32dc00fb7d669ULL, 0x59007d0fecdcfULL, 0x006b33f11f3c1ULL},
+    {0xf9e3b09dd80b4ULL, 0x3cc023fd27246ULL, 0x1c8a2da82c4e3ULL, 0x02f5cfae49e54ULL, 0x000b2c6bf8368ULL},
+    {0xd51ea3010104fULL, 0x0d552dca0aca2ULL, 0xdbd40f9823697ULL, 0x004efc91210bfULL, 0x01bfc23700d01ULL},
+    {0x2f330594d14a6ULL, 0x9bfb02d5a8addULL, 0xc8c9bcfd26e25ULL, 0x05c916795d0a0ULL, 0x01ab510bbb649ULL}
+};
+
+/* Sparse matrices as (w0, w1, w2, v0, v1) */
+static const _Alignas(CACHE_LINE_SIZE) uint64_t POSEIDON_SPARSE_R52[48][5][5] = {
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x19f9ec02ec390ULL, 0x8181585d92e24ULL, 0x31a02985045b6ULL, 0x00130644e72e1ULL, 0x0000000000000ULL},
+        {0x08c16d87cfd37ULL, 0x916871ca8d3c2ULL, 0x181585d97816aULL, 0xa029b85045b68ULL, 0x030644e72e131ULL},
+        {0x9f9a165cfd684ULL, 0x0793459e9cd61ULL, 0x21bfd9948146fULL, 0xd1ce05275c32aULL, 0x00305e6e77ed9ULL},
+        {0x297dc1c4b8ea2ULL, 0xcea1bdd592b28ULL, 0x25ee9ebf1cb36ULL, 0x2b05e7edd38c1ULL, 0x0079671433a0eULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xd3bc39e4bea27ULL, 0x0add44d0df574ULL, 0x0669efbd493b9ULL, 0x2c412ed949df8ULL, 0x007d59a71f546ULL},
+        {0xd4695558e1ef8ULL, 0x4aff8d14b078dULL, 0x49a6b3a41922dULL, 0x75358ee347f7eULL, 0x01553610639dbULL},
+        {0xbab1f0aa76277ULL, 0x81aab0cc55555ULL, 0x68dd49cac899dULL, 0x978066b93efdcULL, 0x009303d8a8349ULL},
+        {0x3eea59aee1fb3ULL, 0x682fced12c6bcULL, 0x97743ef680c27ULL, 0xf90330dc86b80ULL, 0x01d2b6f5985d2ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xffe5398103892ULL, 0x136685c6aa4caULL, 0x7d9554df7ba88ULL, 0x9a849cf66ffe8ULL, 0x006e1bebd3b83ULL},
+        {0x773d9d26468cbULL, 0xb2b6f7ebf1429ULL, 0x681315308488fULL, 0xe0e1ce07bc28aULL, 0x023f05bd78e9eULL},
+        {0xdab89d675b270ULL, 0x875748217ccf7ULL, 0x84109bd8e1ef7ULL, 0x8fa5b01c134a7ULL, 0x0008c419386efULL},
+        {0xb3cacfe4997aaULL, 0x0164f7b737e16ULL, 0x78837d30c10b1ULL, 0x2b56523218ca9ULL, 0x022fdd84836b2ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xb25171b003928ULL, 0x35b6f844f89f5ULL, 0x294e86f1737f2ULL, 0x8e6f8179bd41cULL, 0x0039afd5ab11aULL},
+        {0x0107552efa9fdULL, 0x32a2c7496c6d7ULL, 0xacdd41cf1fbf0ULL, 0x48d0e7eab4951ULL, 0x0235da0876f29ULL},
+        {0x1c2781d211266ULL, 0xf4843f92d61e0ULL, 0xbd7a8e522b3bcULL, 0xc0d5918baa4f7ULL, 0x005b21a869170ULL},
+        {0x9bbeddf412f1cULL, 0x793ee14c8392dULL, 0x45998967df9cfULL, 0x785fd28d2c81cULL, 0x0297d3a30be7aULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x27a6f49899437ULL, 0x045a409591617ULL, 0x2d0292a3b0e8eULL, 0xe7577c2007c70ULL, 0x0109410cd3a9fULL},
+        {0x46e23e5a7a20eULL, 0x36d70aff1a09fULL, 0xe71d3e2ce16d7ULL, 0xb4c44df467067ULL, 0x0280e3398d6eaULL},
+        {0xf7be8e7e45d12ULL, 0x43145cfa8036aULL, 0x378eb0e8ddbbfULL, 0xbaf3d3ef2d1e1ULL, 0x00c81f9d0e2a4ULL},
+        {0x53e46c9208a63ULL, 0x270abdcbd4607ULL, 0x6409960215af2ULL, 0x3699d9e9c3b29ULL, 0x0008e2a9e174aULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x1de198a5a25fdULL, 0x2bd16ce2412b7ULL, 0xd838f6ec39231ULL, 0xb2bfb2f5b5e86ULL, 0x007ac4f1c7775ULL},
+        {0xc7c9094fa6c17ULL, 0x853e8fd9e4035ULL, 0x866527db66859ULL, 0x19b89084c77e3ULL, 0x02b3250213445ULL},
+        {0x879068b2e0c87ULL, 0x0b876ce776747ULL, 0x96945c0789b3cULL, 0xcca2ae82ad6ddULL, 0x00b29e2d33a0aULL},
+        {0x6bb9a923716dcULL, 0x7b391b6815877ULL, 0x4084768480a61ULL, 0xbbd6f8bddebb2ULL, 0x016a302c0e535ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x46a36439597ccULL, 0xf3cacdc4aa6f8ULL, 0xa9b83514c2937ULL, 0xcdfaf2ab7909fULL, 0x004fd12426732ULL},
+        {0x7362b9ad264c2ULL, 0xcd960791753e9ULL, 0xf142926bbfabdULL, 0x5e8a26c2e2ad7ULL, 0x00e1895215ab9ULL},
+        {0xdae6d4f2f5922ULL, 0xf6ce712036d9aULL, 0xa2503473bd207ULL, 0x9f7d73cfcb072ULL, 0x01c5c61204b7bULL},
+        {0xb82655cb4f7eaULL, 0x7c5c8868fc7b7ULL, 0x0b33661917023ULL, 0x7036e408cc294ULL, 0x01533d7df1c7cULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xc21f7fa0d4921ULL, 0x8360f9e8fc0b5ULL, 0x4555cf61e7248ULL, 0x41ac29d872860ULL, 0x01a034f45c771ULL},
+        {0xdf7cc458ec190ULL, 0x3a06f6cfe950aULL, 0x05bd4af7e99f1ULL, 0xf39c2fe03eeedULL, 0x00addcd4fbb13ULL},
+        {0x6dd3d907e4f61ULL, 0x5815216970660ULL, 0xfd9f4054a5fd7ULL, 0x5a201030ac55aULL, 0x020f34a0f9d2dULL},
+        {0x889b137240227ULL, 0x3801e8ac15a10ULL, 0x64d3373bb226aULL, 0x905f2fde2ab56ULL, 0x01a9ae68864acULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x812108664a2d5ULL, 0xa7c5572616d2eULL, 0x8dc5573a1be47ULL, 0x32252f27bd7d9ULL, 0x01e13f89525baULL},
+        {0xb4e47defd031cULL, 0x52d2f8720a806ULL, 0x53758a5b9c654ULL, 0x5049a0cfc5e81ULL, 0x027e61842cdd0ULL},
+        {0x25173597c92b9ULL, 0xab9861368e169ULL, 0x857390d98791eULL, 0x516f9616868aeULL, 0x000e5d970b135ULL},
+        {0xff419170ac6e9ULL, 0x8b973d39fdda5ULL, 0xcadf897a51a2cULL, 0x1bb91d3726901ULL, 0x02cbc61393d06ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xb3f85de3640a4ULL, 0x0c4811de783a6ULL, 0x38adb159c83e8ULL, 0x7fa0b217ffceeULL, 0x006b8afabc3e8ULL},
+        {0x9fc15f3f8266bULL, 0x3f1373154792cULL, 0xb94fa9e9b1234ULL, 0x4804f109dab4aULL, 0x02ae53b0cd56fULL},
+        {0x27b20fe604ee2ULL, 0xcee28cb29a601ULL, 0x73fdae448c6f1ULL, 0x31ba71bd7a414ULL, 0x01cc6a1b89023ULL},
+        {0x30fdd427f6ff6ULL, 0x44a1553ff33c3ULL, 0x6f56b0e0ae09eULL, 0xca28816665fd7ULL, 0x02da11a15c4b5ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xa146409c860afULL, 0xe0c59c7f52927ULL, 0x722cd1556103aULL, 0xe0f3b6f8a747aULL, 0x03042ef83fce0ULL},
+        {0x77f9a45b69a19ULL, 0xc326aa69c9b5aULL, 0x344e0db44b13fULL, 0x96322b9f7954dULL, 0x012a707b0f1f3ULL},
+        {0xba321d71240e4ULL, 0x521d5e8482490ULL, 0xa78e10a3198e1ULL, 0x46ffe13282651ULL, 0x028caf3bfb550ULL},
+        {0xc19dabcd0ffb8ULL, 0x0c40fd4394c95ULL, 0xed7a1880ed594ULL, 0x64d4186a8b4dcULL, 0x0090177cd17b8ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x5781cadd18a23ULL, 0xafc50d9c8cd2dULL, 0x2030980cbe588ULL, 0xcbfe32c80912cULL, 0x020eaab28b7cdULL},
+        {0x77e6a9625e592ULL, 0x3a891d6b85b0cULL, 0xf0982be6bab98ULL, 0x8631683903458ULL, 0x01ba23af4d53bULL},
+        {0x2d04d0ed9630aULL, 0x0271988617895ULL, 0xa70f8f59a93a1ULL, 0x7ae6322f4147fULL, 0x010406b9f05f9ULL},
+        {0x436c50e464ac5ULL, 0x5b883f64c7afcULL, 0x8609e45aeb425ULL, 0x34f2a3f04d96bULL, 0x008f5512c8051ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x7f42ee8f78facULL, 0xe0d02bcfc0855ULL, 0x98bf3a224a30cULL, 0xc4e2f50050ef7ULL, 0x012d6fd22e662ULL},
+        {0xbd9eb269ac90dULL, 0x1c3e8c354e3a2ULL, 0xb7ca011ac5f7dULL, 0xc745fe6fab2c7ULL, 0x0057ef5767798ULL},
+        {0x099cefb6f5697ULL, 0x6d8f5aef166bcULL, 0x51c8ed3434689ULL, 0x4842e5caeff07ULL, 0x023a4cd0bfc0eULL},
+        {0x02786954498d8ULL, 0x7a868c527c24aULL, 0x0515e73dc89ebULL, 0x5b33a85b06b3bULL, 0x0165082351fccULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x597e1bc8f3ae0ULL, 0x8c30915b3d336ULL, 0x761678169b1a9ULL, 0x57599281588c2ULL, 0x02e421a47da35ULL},
+        {0xf7d4705636111ULL, 0x23e2a0e3564e8ULL, 0xba3ab48c95773ULL, 0x2f585df5c8017ULL, 0x00aa5d312b5a6ULL},
+        {0xae4ffde5029d1ULL, 0x7bc5ebd01d26dULL, 0x490ed5451a340ULL, 0x675a48484c565ULL, 0x02ef30540e656ULL},
+        {0x4ae5c87a7cdfbULL, 0x3ae76afcee669ULL, 0x0092ba2ced1a3ULL, 0xe23a0f922e212ULL, 0x010f4ecab7252ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xf4aae6c42723dULL, 0xe659c6b50fd80ULL, 0x073ec249f50d1ULL, 0x3887fed22c868ULL, 0x02dc70574ad0bULL},
+        {0x5173d22b6c513ULL, 0x8bc9266bff986ULL, 0x335cff032bd8aULL, 0xb075cf309bbf4ULL, 0x003ab837d9888ULL},
+        {0x8bce1f1124414ULL, 0x33e199cadd294ULL, 0x18acc4f851220ULL, 0xd862e8c5a7844ULL, 0x00e71f3db16deULL},
+        {0xd22b0a3369f20ULL, 0x7f9f7c02db8fbULL, 0x7e87726118119ULL, 0x235488e00b93fULL, 0x0156d562da9daULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x4988ecc1c064cULL, 0x1230a45ab31bdULL, 0xc8b81e01ac95aULL, 0x8c0f68387f2c1ULL, 0x000003a5e7511ULL},
+        {0xd1e0fdbf0895aULL, 0xadaee20a01103ULL, 0x0928bcdbdb8a1ULL, 0xb06f7be95bd3dULL, 0x01f76d036b228ULL},
+        {0xa43a8ff56f0e4ULL, 0xdb2d67cac2095ULL, 0x6d810d3af951fULL, 0xa0a13e40163bdULL, 0x02323f8af6771ULL},
+        {0x6ef7c9c054a1eULL, 0x32a77ae461f08ULL, 0x25fc1c839d93cULL, 0x6b1990bb57899ULL, 0x0288a1539e4fcULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x0d6ca7001506eULL, 0x898346a06f5adULL, 0x04a2bb13f62a1ULL, 0x226f12843afa7ULL, 0x00f060346f342ULL},
+        {0x74dd07494486dULL, 0x1e7d5368afb2fULL, 0xe0f1d29c8b49eULL, 0x18ef2dfc9db13ULL, 0x00b511a03f882ULL},
+        {0x5d51d8d33b865ULL, 0x48c8952c1af66ULL, 0xd169ec511108bULL, 0x072bb5fe45063ULL, 0x0140fda79ba93ULL},
+        {0xd130e4ed2ddedULL, 0xe247991435932ULL, 0x6363f83f45f9dULL, 0x6a1f9d51bd9b6ULL, 0x01f31b01c33f1ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x88769cc2c087dULL, 0xdc7dd2d4201e2ULL, 0xf8ea5c561f9b7ULL, 0x1eab89b947d82ULL, 0x02a49e5fc9fb4ULL},
+        {0x925a36c6db808ULL, 0x825638a413765ULL, 0xf07a65b8cb43eULL, 0x0d34571cb5926ULL, 0x022e686facb02ULL},
+        {0x62653177189b7ULL, 0x13edf88109033ULL, 0x210dc5507b4d8ULL, 0xa234464b20d85ULL, 0x01a01622b99d9ULL},
+        {0x317e9b5551231ULL, 0xf6e6c99d6df44ULL, 0x29827f2e6f91eULL, 0x7e76ccc0ca5feULL, 0x02910565faa92ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xc0fd7645fd998ULL, 0x888f119fa6f0fULL, 0x47890d155a6d2ULL, 0x8fbd79a58b5eeULL, 0x02a251cb921a1ULL},
+        {0xa0c86c0b09cd0ULL, 0x4d1146f9e5ffeULL, 0xb5197ebc5dab1ULL, 0x35efd5839f99dULL, 0x024873da6d496ULL},
+        {0x9090dcf009824ULL, 0xb7804e1c6daa6ULL, 0xa05208657395fULL, 0xbafd565afee89ULL, 0x01402179d8197ULL},
+        {0x5fed9800c7adbULL, 0x217ba964869c3ULL, 0xd2a22f6b18818ULL, 0xc5fa407fc629aULL, 0x024f9b5476987ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x142845a04f678ULL, 0x65b816051b68cULL, 0xbec5557a7c6c8ULL, 0xe8dbfddaaa76aULL, 0x003015f993806ULL},
+        {0xfe175c3ef0625ULL, 0xa2acfcf0f405fULL, 0x4757d69f5c920ULL, 0x8395e082907e5ULL, 0x0193d27f34ebaULL},
+        {0xffdae7e2f40cfULL, 0x6ccd9bdeeacfcULL, 0x61c9f6087d1f9ULL, 0x6582d4d41d612ULL, 0x00604c40d0f74ULL},
+        {0xcaa772e537ee5ULL, 0x26c9abb79fdd0ULL, 0x1e3ae839a8e26ULL, 0x2d697794a8cc8ULL, 0x01a3900adbb6bULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xb817c9d6dd2a7ULL, 0x1db1511a74354ULL, 0xa2b4c8c7ce9cbULL, 0xd3e3ef19e9337ULL, 0x014640c235347ULL},
+        {0xba702da4afb58ULL, 0x9ef779b4721eaULL, 0xc80bac674b7dbULL, 0x499e330f7aa37ULL, 0x006d9491947d8ULL},
+        {0x63ee75031bd6bULL, 0xbbb75c59abe4cULL, 0x7713616c41a88ULL, 0xcf2ac42bade0aULL, 0x025a5e104b6fdULL},
+        {0x2574de4ca0100ULL, 0xf2528c78da17bULL, 0x5b05260ab2aeaULL, 0xe7ef01f84c706ULL, 0x01e6f6456eeabULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xb87ebc6186c5eULL, 0x04e0d0172a49aULL, 0x9cd5c86b25037ULL, 0x71173821f53f4ULL, 0x008432b75556fULL},
+        {0xf1574127f2527ULL, 0xcaa6267e4112fULL, 0xf9f7f42cb20dbULL, 0x831093444ab92ULL, 0x00d161ab2250aULL},
+        {0xdee5efb03875eULL, 0x09b647f128cdaULL, 0x371b490629fd3ULL, 0x7656ace006cceULL, 0x006abe987beecULL},
+        {0xbc65b6e03bf4aULL, 0xd65ce4f6843d0ULL, 0x0ebcd8a04c165ULL, 0xd76ddee5617c6ULL, 0x025c1e22dbf7aULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x075ffe0683ba1ULL, 0x3a2284bb021a2ULL, 0xec8b5566bc2f7ULL, 0x63bb6b4deef4dULL, 0x004872b32111cULL},
+        {0x9b195efc877adULL, 0x97384c2f83e7fULL, 0x1320cb0154a2fULL, 0x338d5ad040c82ULL, 0x02aa12777ff28ULL},
+        {0xdc0e36232e74dULL, 0xfcc9f40469c7cULL, 0x03bb13cec8584ULL, 0x838382758aba0ULL, 0x006db9dded3faULL},
+        {0x3e86775abf21dULL, 0xdc955526ca030ULL, 0x569f56d3652f0ULL, 0x91a232d9a91d1ULL, 0x00ad9efa63ef7ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x18e78a196c69cULL, 0xbc98a96fefbcbULL, 0xa9ac4d6cfa7f9ULL, 0x67a4269210e8eULL, 0x018fdd53f0087ULL},
+        {0xb8688f8b1311aULL, 0xbc9f5a148dcf0ULL, 0x646d148a016e1ULL, 0x9d5880260f6e7ULL, 0x00d1daee3f49fULL},
+        {0x1632af83c9313ULL, 0xd36c4fb6887ffULL, 0x6e13a9e89db2fULL, 0x3ddc85a12cf5cULL, 0x01242daddd107ULL},
+        {0xbe045bda04926ULL, 0x86ade02672155ULL, 0x1a0761e487402ULL, 0xc8de7a3c06de1ULL, 0x02a187b689fc6ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x3f162d8772348ULL, 0x1c1a2e4e5e918ULL, 0xd2c93e2dfbba5ULL, 0x2ba7d8a8ed380ULL, 0x01694916496a8ULL},
+        {0xca3d8cd7e03b3ULL, 0x8c173d72aa63aULL, 0xb17a92d0868a5ULL, 0x1be9ff723bd7cULL, 0x018f161a7173bULL},
+        {0x386fcfe65091cULL, 0x38e1785fd4bfeULL, 0x7df6206b7a51bULL, 0xf9357f32754d5ULL, 0x0144e4b451dd8ULL},
+        {0x14a243eaa631eULL, 0xc20e0ceaa43a6ULL, 0x9e24e90de4e57ULL, 0x5bc6d9889e728ULL, 0x01ed45ff4e6f6ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x5a29f5246fac8ULL, 0xd1191dc6e3cccULL, 0x535507ddb969bULL, 0x88c133b918ff2ULL, 0x0050144131098ULL},
+        {0xa3fe964d15a56ULL, 0xda4150a1d568aULL, 0xed2fbc56214d0ULL, 0x7a9996ffb8309ULL, 0x01fb9bdba597bULL},
+        {0x1985970df7d67ULL, 0x389614ce74de6ULL, 0x0f0fb70ae8c96ULL, 0x4455e3d7e37c0ULL, 0x02f4be8f5d39eULL},
+        {0x594861b2e00a0ULL, 0xfcb52e62474e2ULL, 0x01f45de76a42dULL, 0x1c4aa659e9483ULL, 0x02b34b274bd31ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x95afe81fb9b44ULL, 0x2f1c35e594b6eULL, 0x12f97de970099ULL, 0x94d1c68bf5304ULL, 0x01bd09031ac0eULL},
+        {0xf27d3dc926924ULL, 0x3fc9bb9f41763ULL, 0x4256437ea1c73ULL, 0x002f0ff102665ULL, 0x0269f04353cccULL},
+        {0x47b5b2d907dacULL, 0xf49756f0fb479ULL, 0xdd932bf12c0dfULL, 0x439d3c51efe05ULL, 0x01c5a7f1f98b8ULL},
+        {0x8470ae524dc9cULL, 0x9ee86e0e3b67eULL, 0xeca689cf86631ULL, 0xcfa3fdebe3d8eULL, 0x000fbcdc800d0ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x3641701a3fa73ULL, 0x314d2dfed7d2cULL, 0xf237eb8b3417cULL, 0x215e4bdb080ddULL, 0x00b7490642ca4ULL},
+        {0x4b480c1450444ULL, 0xcdbb5494c128aULL, 0x7d397008d8c39ULL, 0x3288a32d8c227ULL, 0x01a4fcfdd3ea0ULL},
+        {0xd1c52a7f70c46ULL, 0x7df5598cbe728ULL, 0xaa044688a3b72ULL, 0xfd22b6948aba9ULL, 0x00b98c3a69226ULL},
+        {0xa1d518937cac5ULL, 0x8d77784ebdb26ULL, 0x6263d3cd34ed8ULL, 0x5af4c29b279d4ULL, 0x0055f072a9618ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x43c620f236d79ULL, 0x2034941c2222eULL, 0x6b02e42991cdfULL, 0xe28939b8d19f5ULL, 0x0060841804b7dULL},
+        {0x32892b72b7457ULL, 0x3ded72e041466ULL, 0x12a796ac87ea7ULL, 0xe028510692317ULL, 0x02a5d5734ee96ULL},
+        {0xf9438ab0f7c17ULL, 0x0202f3a9f31fcULL, 0x2ea9f66babbbfULL, 0x581e852a2d819ULL, 0x016c372cd4830ULL},
+        {0x9c6f42d8c94d5ULL, 0xf107f82ca55c8ULL, 0x7c186492762f3ULL, 0x356f8d1db8d3aULL, 0x0178d23cf5912ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x6cce3cf395b78ULL, 0x55c41a5b54c74ULL, 0x6a56e50865333ULL, 0xd89217a843855ULL, 0x0110aee92eb3bULL},
+        {0x9d985cef5c928ULL, 0xe7333a5e505a3ULL, 0xc18c6f7ddcc1bULL, 0xdf57c03b77b48ULL, 0x00aae4d8c2bdaULL},
+        {0x4efd5c4ac6f17ULL, 0xa48ab546c12dbULL, 0xa67b5e6aab2f8ULL, 0x66128bf79a719ULL, 0x028591056c010ULL},
+        {0xa9a5dda378e48ULL, 0xac5abd869ac0aULL, 0x404a138473329ULL, 0xcfa904aa6ade4ULL, 0x02274255e195aULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xaf01356d6070fULL, 0xe2f2fc75b6d0cULL, 0xdf6def92b5977ULL, 0x357107e15f6f6ULL, 0x0141398778693ULL},
+        {0xbfb99c774150cULL, 0x1322d0748502cULL, 0xdb6c0cadde83bULL, 0x1506156b4e79cULL, 0x01cb881aa8716ULL},
+        {0x1f44370712556ULL, 0x542d6e20ab113ULL, 0x6d2375558601dULL, 0x8726480bbeb75ULL, 0x02e6b0e187e9cULL},
+        {0xca2902805f417ULL, 0x13d7ad75216e5ULL, 0x4e9fc8db40e51ULL, 0x49d408d014634ULL, 0x01c84a801e22bULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x62eb85a1d75a2ULL, 0x609e88afe5840ULL, 0x1226eff25b8daULL, 0xf37cf30de2a7dULL, 0x00312e47ef0a2ULL},
+        {0xc00c52386658fULL, 0x3261621eeee61ULL, 0x849f1d0545799ULL, 0x30143f3c3eac0ULL, 0x028c8edb3a5aaULL},
+        {0xbaaafd69830a9ULL, 0x52b2c2f991ee1ULL, 0x2f588ce246194ULL, 0xdb49c09b2da06ULL, 0x0300e0dfade96ULL},
+        {0x109c3cc189840ULL, 0xfa7a5658a9ce7ULL, 0x8d10d6ebb067fULL, 0xaafb0466bd485ULL, 0x0043a52c07ddaULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xba2d781ccda0eULL, 0x3b1bb3ead79bbULL, 0x86709b3227619ULL, 0x4facd1be31430ULL, 0x00c999f02babfULL},
+        {0x9f19e9bd1d86eULL, 0x0e7392e9fd055ULL, 0x780e2b1bd7dd1ULL, 0xf4f6fce30d201ULL, 0x02b2834ce4000ULL},
+        {0x8e93341606845ULL, 0x2492abdd926b1ULL, 0xe7aa380a1a756ULL, 0x80093232b3defULL, 0x01df8cfbf5593ULL},
+        {0x489ce6144d573ULL, 0x17439097666e4ULL, 0x719f007e68466ULL, 0x2aa0685859673ULL, 0x02c491f299273ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xf6550a3ce70d7ULL, 0x4bc060d1632cdULL, 0x7530d21e1240fULL, 0xedd8a282be2d0ULL, 0x02571a40f913fULL},
+        {0x882f6d2a15a82ULL, 0xfee35dd93d80aULL, 0x7f4931cb1d967ULL, 0x954545d1dea85ULL, 0x02311f8cdc11aULL},
+        {0x31259675fd3b0ULL, 0xf9b4ef05af419ULL, 0x212cf3e337734ULL, 0xcf0c6cb78e44dULL, 0x005aef6b72131ULL},
+        {0xef64b8172184fULL, 0xf3dd1a85e39daULL, 0xac82b207aa597ULL, 0x42f2e099f15f5ULL, 0x013e2e62e8c5aULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x0320b20c0f76fULL, 0xc58edc2adf300ULL, 0x2763940ac2de2ULL, 0xc6c8fc4804441ULL, 0x015285f4a3adcULL},
+        {0x0fc83c808fb00ULL, 0xa64899ef668beULL, 0x0fef739264768ULL, 0x9b5cb2e02a48cULL, 0x021138211ac93ULL},
+        {0xc71cf077fe25eULL, 0xfc3f1543f79baULL, 0x610c3718d987dULL, 0x84adfae5d56c9ULL, 0x003ef3e985f53ULL},
+        {0x7937e7a1aa315ULL, 0x35a8db838b70cULL, 0xdeb30eccaac07ULL, 0x7e0828f075e7eULL, 0x016bbfffb1827ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x9fa347dd4b570ULL, 0x2a4ddd27e537bULL, 0x22d87dc2b6ef3ULL, 0x9e28fc0e97ed4ULL, 0x00c4caad6030cULL},
+        {0x5021641dcf396ULL, 0xba76d6e8a676bULL, 0xd7afca4d87564ULL, 0x0722c3e7d7086ULL, 0x0098dd027122bULL},
+        {0xf0903f1d68cc0ULL, 0xe36f65da9c393ULL, 0x734d5926cac39ULL, 0x0ff0d9769b861ULL, 0x0233d0b16ed4aULL},
+        {0x86dabe3f6e52cULL, 0x1710a4964ed06ULL, 0x00349082f03a7ULL, 0x96aa58fbc292aULL, 0x011a633fae085ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x4d6fb106bb1f1ULL, 0x00f050e0069b9ULL, 0xd95a9efc4e23fULL, 0x9b23b34c3ab04ULL, 0x013b70e9b45a2ULL},
+        {0xc22f930f398c1ULL, 0xab15e1a047cb2ULL, 0x0fdfa4d1c44b3ULL, 0xaa8970d41b29dULL, 0x00c18bb15b295ULL},
+        {0xa4e8dc0d6c340ULL, 0xe48a4a5a8f5feULL, 0xf458b7af754aeULL, 0x1bad84225970bULL, 0x01073da132785ULL},
+        {0xe1173e6b973dfULL, 0x5a72612c82f73ULL, 0xc252de8275fc7ULL, 0xe4eb1d61eb543ULL, 0x00d7dee3548a2ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x98330e1e21525ULL, 0xc224480375cf5ULL, 0xb285c5d8339dfULL, 0x88ad7d8a6fa8fULL, 0x0228aca2c0b93ULL},
+        {0x0ef70d1e5deb5ULL, 0x9469eb071db3aULL, 0x0b956d6472925ULL, 0x94cec9b9e18f2ULL, 0x00f6ce3885655ULL},
+        {0xe8b01f638812aULL, 0x1cc69eb49a94cULL, 0x6a6e5d5657c4fULL, 0xf7c078639074bULL, 0x01a87cd444a5eULL},
+        {0xca3da94541fa8ULL, 0x4944ac85eac08ULL, 0xaeb0af7ff4b69ULL, 0x3528828f7a8ebULL, 0x01ba8f936e09bULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xeb01c475fdfe0ULL, 0x69843036b8feaULL, 0xae14b60b38e70ULL, 0x0d862b1aa7157ULL, 0x015b478c1e914ULL},
+        {0x5fc3134195e1eULL, 0x7d8d60b077db1ULL, 0xb6d845320406fULL, 0x21f0d4d97a8c7ULL, 0x02be9ae3dd8b2ULL},
+        {0xac5e15c499006ULL, 0xb44cf02be3891ULL, 0x33ce8d151b09bULL, 0xb9a508c0ce112ULL, 0x0131c563f922cULL},
+        {0x1ee6d73bec5f8ULL, 0x612e9716768ccULL, 0xc0724646d104aULL, 0x2d4c9b5c90fdcULL, 0x00ce765374535ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xa0b3e97a57ef2ULL, 0x59160b38655e7ULL, 0x0d79a47c20fd1ULL, 0xfacfa35312a31ULL, 0x00baa342f0e41ULL},
+        {0xaf0ba5754f5afULL, 0x16aed6906218cULL, 0x02ea92df48ac1ULL, 0x741817eed76a9ULL, 0x014f7c39009abULL},
+        {0x1ee9175aace59ULL, 0x9a23c9438f9dcULL, 0xe908c99c3e884ULL, 0xe4138fd852d9eULL, 0x01296b24a1b9bULL},
+        {0xfea5bb4b312fdULL, 0xe3851a53ade49ULL, 0x170caf17ae2a9ULL, 0xddf33aeaacc81ULL, 0x01c0281ac55c7ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x4a3b9aa1542bfULL, 0x55372094e8224ULL, 0x84ccbb7c728eaULL, 0x5ced294e25144ULL, 0x01b9d1e048130ULL},
+        {0xb20c6f81b8e5fULL, 0x01464430c2a67ULL, 0xe9d08ad30b649ULL, 0x371087a5218e7ULL, 0x00e8d04d10b53ULL},
+        {0x6c1261281bd93ULL, 0xf0634a19626afULL, 0x49c8e40d7995dULL, 0xa913be2910de7ULL, 0x01f583289796fULL},
+        {0x9fba38685b7e0ULL, 0x16bdbb1698032ULL, 0x97680872e7690ULL, 0x2a6d84ec0b7f0ULL, 0x02f5e04c47a5bULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x8f656fbb769efULL, 0x9bf506aab8295ULL, 0xe750b6945cc39ULL, 0x6ade5a4ea46a6ULL, 0x011d9208cc533ULL},
+        {0xa60ad6af9fc19ULL, 0x8eaca89cfbc9cULL, 0xfce65cbbb1492ULL, 0x7ef5af85a36c7ULL, 0x007c25fa26176ULL},
+        {0x5db3cb81cd618ULL, 0x068fdec64ff34ULL, 0x90c94a56c3d5dULL, 0x282aa3ff6279bULL, 0x0103f4781da6dULL},
+        {0x993595aae0220ULL, 0x31f1fa7e67295ULL, 0x316b921d6bce9ULL, 0x17d5b06c30d7aULL, 0x00a373bc64098ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x719ef24572d22ULL, 0x67119fea9a6e6ULL, 0xa8cbbe94de266ULL, 0x5cf205c640ff1ULL, 0x0101cc13da44fULL},
+        {0x5c7dab3377185ULL, 0xde303dd9653bdULL, 0x2d36aff1244f6ULL, 0x9b5582d7cd6a7ULL, 0x0081a7d7430c7ULL},
+        {0x0e7a95654181eULL, 0x67521bee31a93ULL, 0xde1fb5ee59ae3ULL, 0x64e34f1aa252dULL, 0x01c7e806ca65fULL},
+        {0x1a83e1896b0a1ULL, 0x0abcec5597573ULL, 0x3be5975a8fb13ULL, 0xc938c9adf82b3ULL, 0x02679e511125dULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xdc4fe7f85c0a9ULL, 0xd12be80dcbec8ULL, 0x97eb28e27064dULL, 0x31b5c4c53cf92ULL, 0x012a9da9cbbcaULL},
+        {0xb1d978b453e74ULL, 0xd05a30b0442e9ULL, 0x47d6f4935bf08ULL, 0xcd47f261a7f8fULL, 0x02e292faa1eacULL},
+        {0x4fc097fddcf2dULL, 0x68ba65c9d73caULL, 0x2f2a96613bf2fULL, 0x4980c4ae529adULL, 0x0189dd1f9040bULL},
+        {0x8001ca8a5162fULL, 0x72f8fc6a39fe5ULL, 0x8623a7405ae5cULL, 0x65eb113d74addULL, 0x00f1ed2dddad6ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xf9ae943c9b1b5ULL, 0x016d12bec2b5cULL, 0x1d00d76c1ec19ULL, 0x5782bff6d355bULL, 0x0187c2d28b447ULL},
+        {0x81c0ee574749bULL, 0xe17680ab5798aULL, 0xa4ee82c2d8093ULL, 0x07e162133ab45ULL, 0x000fd291d73ccULL},
+        {0x49bea18982da2ULL, 0x51230ae4d586eULL, 0x43663c0b14b02ULL, 0xe8a4d93ab9d38ULL, 0x02e4863739fd1ULL},
+        {0x4be55f728d481ULL, 0xaa93c7ed6074eULL, 0xf4c072f7d72e8ULL, 0x097f2c1bdcc0eULL, 0x027e29db2ad17ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xaa04a6d9d4f1eULL, 0xafe92ded8d001ULL, 0xd3516afc37ed5ULL, 0x96251c2ea6bb5ULL, 0x02184fe10ed4bULL},
+        {0x3fa84f2bdda64ULL, 0xfe50bd175d94fULL, 0x5c3aa92cad7b5ULL, 0xd28f5e04f8c49ULL, 0x013c39cebb508ULL},
+        {0x6dfa8dffb7321ULL, 0x89642c522092dULL, 0x4f8eac95d963aULL, 0x8fa90b860a2d6ULL, 0x003ef716f35dbULL},
+        {0xc37c4971cfe95ULL, 0xdbe459f6d9ae2ULL, 0xb250066899144ULL, 0xaf5108d6d18f9ULL, 0x01ef41d850f09ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x67b3a6254c5f7ULL, 0xdde3d98610d4fULL, 0x81ae830a9ebbdULL, 0x087f06cf0e6a1ULL, 0x000ee49353d84ULL},
+        {0x039139bc7909bULL, 0xeb05a52bd2e19ULL, 0x16950fd3570edULL, 0x32d1ee03d54adULL, 0x01b683d79adecULL},
+        {0x09875fa2b3471ULL, 0x9d26ff4703120ULL, 0x3b1a2c0e46037ULL, 0xdf59a6c0240b1ULL, 0x02fe9da5dc3bcULL},
+        {0x42caecd741534ULL, 0x3c4ac25de50a2ULL, 0x64fd5af9daf13ULL, 0xcf1e8a78550cbULL, 0x001748c410e34ULL}
+    },
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0xb5227fe1e2058ULL, 0xedaaf07c4f3a1ULL, 0x3872e9ef55e43ULL, 0x700c28aca2c03ULL, 0x001459dbbf65bULL},
+        {0xab530ad20e8aeULL, 0x59b618e61b8b2ULL, 0xd870be0cba23fULL, 0x1fa84564662beULL, 0x02c1da064fe3aULL},
+        {0x8e23b99f9303bULL, 0xd9621bc70763bULL, 0x5561ceeb1251aULL, 0x223a3b165e22bULL, 0x00f28b1bad098ULL},
+        {0x40cc9d9c0f282ULL, 0x58c3db0ff3659ULL, 0x9f49d37d97203ULL, 0x371ebb73a45cbULL, 0x02a2a4beb8f0aULL}
+    }
+};
+
+static const _Alignas(CACHE_LINE_SIZE) uint64_t POSEIDON_MDS_LAST_R52[3][3][5] = {
+    {
+        {0x64fcd309754bbULL, 0x5e42c09e59555ULL, 0x8f65284a33168ULL, 0xbd58644ead3abULL, 0x0272fef11bc05ULL},
+        {0x35abd7604a8deULL, 0xb9c50692785edULL, 0xcd8750cdc7d39ULL, 0xf050dd3af5686ULL, 0x0002d7dda8d08ULL},
+        {0x39e32e159c2aeULL, 0x349a44577cf4dULL, 0x7d4985e4206d4ULL, 0x53cceae99e135ULL, 0x0139310c9d512ULL}
+    },
+    {
+        {0x19f9ec02ec390ULL, 0x8181585d92e24ULL, 0x31a02985045b6ULL, 0x00130644e72e1ULL, 0x0000000000000ULL},
+        {0x00d2a5ad1d4ffULL, 0x4c2b40013d526ULL, 0x655046e73f9e8ULL, 0x86c22171785daULL, 0x020847b7072eaULL},
+        {0x609c5fd177144ULL, 0x5d0b9be441fabULL, 0x6e1c39ace86e1ULL, 0xd1a12a7cc9184ULL, 0x02f6d7c006bbfULL}
+    },
+    {
+        {0x08c16d87cfd37ULL, 0x916871ca8d3c2ULL, 0x181585d97816aULL, 0xa029b85045b68ULL, 0x030644e72e131ULL},
+        {0x609c5fd177144ULL, 0x5d0b9be441fabULL, 0x6e1c39ace86e1ULL, 0xd1a12a7cc9184ULL, 0x02f6d7c006bbfULL},
+        {0x0ecd1fa8f9d49ULL, 0x286d89b55a148ULL, 0xfbcf247b491b8ULL, 0x0a2d9727ae7dcULL, 0x0162b31f6f135ULL}
+    }
+};
+
+#endif /* POSEIDON_TABLES_R52_H */
@@ -0,0 +1,254 @@
+/*
+ * Per-thread ChaCha20 CSPRNG
+ *
+ * Each refill runs RNG_BLOCKS ChaCha20 blocks under the current key; the
+ * first 32 bytes become the next key and the rest is handed out (fast key
+ * erasure), so a captured state never reveals earlier output. The key
+ * comes from the OS on first use, every RNG_RESEED_BYTES and after fork.
+ */
+
+#ifndef _WIN32
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+#endif
+
+#include "rng.h"
+#include "log.h"
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <bcrypt.h>
+#pragma comment(lib, "bcrypt.lib")
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/random.h>
+#endif
+#endif
+
+#define RNG_KEY_BYTES 32
+#define RNG_BLOCKS 8
+#define RNG_BUF_BYTES (RNG_BLOCKS * 64 - RNG_KEY_BYTES)
+
+typedef struct {
+    uint32_t key[8];
+    uint8_t buf[RNG_BUF_BYTES];
+    size_t avail;               /* Unused bytes at the end of buf */
+    size_t since_seed;          /* Output since the last OS seed */
+    uint64_t fork_gen;
+    bool seeded;
+} rng_state_t;
+
+#ifdef _WIN32
+static __declspec(thread) rng_state_t tls_rng;
+#else
+static __thread rng_state_t tls_rng;
+#endif
+
+/* Bumped in every forked child so inherited states reseed */
+static _Atomic(uint64_t) g_fork_gen;
+
+static void secure_zero(void *p, size_t len) {
+    volatile uint8_t *v = p;
+    while (len--) *v++ = 0;
+}
+
+/*
+ * OS entropy
+ */
+
+static bool os_random(uint8_t *buf, size_t len) {
+#if defined(_WIN32)
+    return BCryptGenRandom(NULL, buf, (ULONG)len, BCRYPT_USE_SYSTEM_PREFERRED_RNG) == 0;
+#elif defined(__linux__)
+    while (len > 0) {
+        ssize_t n = getrandom(buf, len, 0);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        buf += n;
+        len -= (size_t)n;
+    }
+    return true;
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+    /* getentropy is capped at 256 bytes per call */
+    while (len > 0) {
+        size_t chunk = len < 256 ? len : 256;
+        if (getentropy(buf, chunk) != 0) return false;
+        buf += chunk;
+        len -= chunk;
+    }
+    return true;
+#else
+    int fd = open("/dev/urandom", O_RDONLY);
+    if (fd < 0) return false;
+    while (len > 0) {
+        ssize_t n = read(fd, buf, len);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            close(fd);
+            return false;
+        }
+        buf += n;
+        len -= (size_t)n;
+    }
+    close(fd);
+    return true;
+#endif
+}
+
+#ifndef _WIN32
+static pthread_once_t g_atfork_once = PTHREAD_ONCE_INIT;
+
+static void rng_atfork_child(void) {
+    atomic_fetch_add(&g_fork_gen, 1);
+}
+
+static void rng_register_atfork(void) {
+    pthread_atfork(NULL, NULL, rng_atfork_child);
+}
+#endif
+
+/*
+ * ChaCha20 block function (RFC 8439), 96-bit nonce fixed at zero.
+ * Keys are single-use per refill, so the counter never wraps.
+ */
+
+#define ROTL32(v, c) (((v) << (c)) | ((v) >> (32 - (c))))
+
+#define QUARTER_ROUND(a, b, c, d) do { \
+    a += b; d ^= a; d = ROTL32(d, 16); \
+    c += d; b ^= c; b = ROTL32(b, 12); \
+    a += b; d ^= a; d = ROTL32(d, 8);  \
+    c += d; b ^= c; b = ROTL32(b, 7);  \
+} while (0)
+
+static void chacha20_block(uint8_t out[64], const uint32_t key[8], uint32_t counter) {
+    uint32_t in[16] = {
+        0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+        key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7],
+        counter, 0, 0, 0,
+    };
+    uint32_t x[16];
+    memcpy(x, in, sizeof(x));
+
+    for (int i = 0; i < 10; i++) {
+        QUARTER_ROUND(x[0], x[4], x[8],  x[12]);
+        QUARTER_ROUND(x[1], x[5], x[9],  x[13]);
+        QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+        QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+        QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+        QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+        QUARTER_ROUND(x[2], x[7], x[8],  x[13]);
+        QUARTER_ROUND(x[3], x[4], x[9],  x[14]);
+    }
+
+    for (int i = 0; i < 16; i++) {
+        uint32_t v = x[i] + in[i];
+        out[4 * i + 0] = (uint8_t)v;
+        out[4 * i + 1] = (uint8_t)(v >> 8);
+        out[4 * i + 2] = (uint8_t)(v >> 16);
+        out[4 * i + 3] = (uint8_t)(v >> 24);
+    }
+    secure_zero(x, sizeof(x));
+}
+
+static void key_from_bytes(uint32_t key[8], const uint8_t *b) {
+    for (int i = 0; i < 8; i++) {
+        key[i] = (uint32_t)b[4 * i] | ((uint32_t)b[4 * i + 1] << 8) |
+                 ((uint32_t)b[4 * i + 2] << 16) | ((uint32_t)b[4 * i + 3] << 24);
+    }
+}
+
+static bool rng_seed(rng_state_t *s) {
+#ifndef _WIN32
+    pthread_once(&g_atfork_once, rng_register_atfork);
+#endif
+    uint64_t gen = atomic_load(&g_fork_gen);
+
+    uint8_t seed[RNG_KEY_BYTES];
+    if (!os_random(seed, sizeof(seed))) {
+        LOG_ERROR("rng: OS entropy source failed");
+        rng_thread_wipe();
+        return false;
+    }
+
+    key_from_bytes(s->key, seed);
+    secure_zero(seed, sizeof(seed));
+    secure_zero(s->buf, sizeof(s->buf));
+    s->avail = 0;
+    s->since_seed = 0;
+    s->fork_gen = gen;
+    s->seeded = true;
+    return true;
+}
+
+static void rng_refill(rng_state_t *s) {
+    uint8_t blocks[RNG_BLOCKS * 64];
+    for (uint32_t i = 0; i < RNG_BLOCKS; i++) {
+        chacha20_block(blocks + 64 * i, s->key, i);
+    }
+    key_from_bytes(s->key, blocks);
+    memcpy(s->buf, blocks + RNG_KEY_BYTES, RNG_BUF_BYTES);
+    secure_zero(blocks, sizeof(blocks));
+    s->avail = RNG_BUF_BYTES;
+}
+
+static bool rng_needs_seed(const rng_state_t *s) {
+    return !s->seeded || s->since_seed >= RNG_RESEED_BYTES ||
+           s->fork_gen != atomic_load_explicit(&g_fork_gen, memory_order_relaxed);
+}
+
+bool rng_bytes(void *buf, size_t len) {
+    rng_state_t *s = &tls_rng;
+    uint8_t *out = buf;
+
+    while (len > 0) {
+        if (rng_needs_seed(s) && !rng_seed(s)) {
+            secure_zero(buf, (size_t)(out - (uint8_t *)buf));
+            return false;
+        }
+        if (s->avail == 0) rng_refill(s);
+
+        size_t take = len < s->avail ? len : s->avail;
+        uint8_t *src = s->buf + (RNG_BUF_BYTES - s->avail);
+        memcpy(out, src, take);
+        secure_zero(src, take);
+
+        s->avail -= take;
+        s->since_seed += take;
+        out += take;
+        len -= take;
+    }
+    return true;
+}
+
+bool rng_scalars128(scalar_t *out, size_t n) {
+    uint8_t bytes[16];
+    for (size_t i = 0; i < n; i++) {
+        if (!rng_bytes(bytes, sizeof(bytes))) {
+            secure_zero(out, n * sizeof(scalar_t));
+            return false;
+        }
+        fr_set_zero(&out[i]);
+        for (int j = 0; j < 8; j++) {
+            out[i].limbs[0] |= (uint64_t)bytes[j] << (8 * j);
+            out[i].limbs[1] |= (uint64_t)bytes[8 + j] << (8 * j);
+        }
+        fr_to_mont(&out[i], &out[i]);
+    }
+    secure_zero(bytes, sizeof(bytes));
+    return true;
+}
+
+void rng_thread_wipe(void) {
+    secure_zero(&tls_rng, sizeof(tls_rng));
+}
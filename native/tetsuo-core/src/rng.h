@@ -0,0 +1,32 @@
+/*
+ * Per-thread CSPRNG for batch coefficients
+ *
+ * ChaCha20 keyed from the OS (getrandom/getentropy/BCrypt) with fast key
+ * erasure. Each thread reseeds from the OS on first use, after every
+ * RNG_RESEED_BYTES of output and in a forked child. Draws fail closed:
+ * if the OS cannot supply a seed, nothing is returned.
+ */
+
+#ifndef TETSUO_RNG_H
+#define TETSUO_RNG_H
+
+#include "scalar.h"
+#include <stddef.h>
+#include <stdbool.h>
+
+/* Output drawn between OS reseeds */
+#define RNG_RESEED_BYTES (1u << 20)
+
+/* Fill buf with len random bytes. Returns false on seeding failure. */
+bool rng_bytes(void *buf, size_t len);
+
+/*
+ * n uniform 128-bit batch coefficients in Montgomery form.
+ * Every value is < 2^128 < r, so no reduction bias.
+ */
+bool rng_scalars128(scalar_t *out, size_t n);
+
+/* Wipe this thread's generator state (next draw reseeds) */
+void rng_thread_wipe(void);
+
+#endif /* TETSUO_RNG_H */
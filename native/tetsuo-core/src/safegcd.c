@@ -0,0 +1,268 @@
+/*
+ * safegcd modular inversion, 62-bit signed limbs
+ *
+ * Follows Bernstein & Yang, "Fast constant-time gcd computation and
+ * modular inversion" (2019), with the hddivstep variant and batching
+ * used by libsecp256k1's modinv64. 590 divsteps are enough for any
+ * modulus below 2^256.
+ */
+
+#include "safegcd.h"
+
+#define M62 (UINT64_MAX >> 2)
+
+typedef struct {
+    int64_t u, v, q, r;
+} trans2x2_t;
+
+void signed62_from_u256(signed62_t *r, const uint64_t a[4]) {
+    r->v[0] = (int64_t)(a[0] & M62);
+    r->v[1] = (int64_t)(((a[0] >> 62) | (a[1] << 2)) & M62);
+    r->v[2] = (int64_t)(((a[1] >> 60) | (a[2] << 4)) & M62);
+    r->v[3] = (int64_t)(((a[2] >> 58) | (a[3] << 6)) & M62);
+    r->v[4] = (int64_t)(a[3] >> 56);
+}
+
+void signed62_to_u256(uint64_t r[4], const signed62_t *a) {
+    const uint64_t *v = (const uint64_t *)a->v;
+    r[0] = v[0] | (v[1] << 62);
+    r[1] = (v[1] >> 2) | (v[2] << 60);
+    r[2] = (v[2] >> 4) | (v[3] << 58);
+    r[3] = (v[3] >> 6) | (v[4] << 56);
+}
+
+/*
+ * 59 constant-time divsteps on the low bits of f and g. zeta is
+ * -(delta + 1/2). The matrix starts at 8 so the result is scaled by 2^62,
+ * matching the 62-bit shift in the update steps.
+ */
+static int64_t divsteps_59(int64_t zeta, uint64_t f0, uint64_t g0, trans2x2_t *t) {
+    uint64_t u = 8, v = 0, q = 0, r = 8;
+    volatile uint64_t c1, c2;
+    uint64_t mask1, mask2, f = f0, g = g0, x, y, z;
+
+    for (int i = 3; i < 62; i++) {
+        /* mask1: zeta < 0, mask2: g odd */
+        c1 = (uint64_t)(zeta >> 63);
+        mask1 = c1;
+        c2 = g & 1;
+        mask2 = -c2;
+
+        x = (f ^ mask1) - mask1;
+        y = (u ^ mask1) - mask1;
+        z = (v ^ mask1) - mask1;
+        g += x & mask2;
+        q += y & mask2;
+        r += z & mask2;
+
+        /* Swap case: zeta -> -zeta - 2, else zeta - 1 */
+        mask1 &= mask2;
+        zeta = (zeta ^ (int64_t)mask1) - 1;
+        f += g & mask1;
+        u += q & mask1;
+        v += r & mask1;
+
+        g >>= 1;
+        u <<= 1;
+        v <<= 1;
+    }
+
+    t->u = (int64_t)u;
+    t->v = (int64_t)v;
+    t->q = (int64_t)q;
+    t->r = (int64_t)r;
+    return zeta;
+}
+
+/*
+ * Up to 62 divsteps, variable time: runs of zeros in g are skipped in
+ * one shift and several bits of g are cancelled per step. eta is -delta.
+ */
+static int64_t divsteps_62_vartime(int64_t eta, uint64_t f0, uint64_t g0, trans2x2_t *t) {
+    uint64_t u = 1, v = 0, q = 0, r = 1;
+    uint64_t f = f0, g = g0, m, w;
+    int i = 62, limit, zeros;
+
+    for (;;) {
+        /* Sentinel bit caps the count at i */
+        zeros = __builtin_ctzll(g | (UINT64_MAX << i));
+        g >>= zeros;
+        u <<= zeros;
+        v <<= zeros;
+        eta -= zeros;
+        i -= zeros;
+        if (i == 0) break;
+
+        if (eta < 0) {
+            uint64_t tmp;
+            eta = -eta;
+            tmp = f; f = g; g = -tmp;
+            tmp = u; u = q; q = -tmp;
+            tmp = v; v = r; r = -tmp;
+
+            /* Cancel up to min(eta + 1, i, 6) low bits of g */
+            limit = ((int)eta + 1) > i ? i : ((int)eta + 1);
+            m = (UINT64_MAX >> (64 - limit)) & 63u;
+            w = (f * g * (f * f - 2)) & m;
+        } else {
+            /* Up to 4 bits */
+            limit = ((int)eta + 1) > i ? i : ((int)eta + 1);
+            m = (UINT64_MAX >> (64 - limit)) & 15u;
+            w = f + (((f + 1) & 4) << 1);
+            w = (-w * g) & m;
+        }
+        g += f * w;
+        q += u * w;
+        r += v * w;
+    }
+
+    t->u = (int64_t)u;
+    t->v = (int64_t)v;
+    t->q = (int64_t)q;
+    t->r = (int64_t)r;
+    return eta;
+}
+
+/*
+ * [d, e] <- t·[d, e] / 2^62 mod m. Multiples of m are added first so the
+ * low 62 bits cancel; inputs and outputs stay in (-2m, m).
+ */
+static void update_de(signed62_t *d, signed62_t *e, const trans2x2_t *t,
+                      const safegcd_modinfo_t *mod) {
+    const int64_t *mv = mod->modulus.v;
+    const int64_t u = t->u, v = t->v, q = t->q, r = t->r;
+    int64_t sd = d->v[4] >> 63, se = e->v[4] >> 63;
+    int64_t md = (u & sd) + (v & se);
+    int64_t me = (q & sd) + (r & se);
+    __int128_t cd, ce;
+
+    cd = (__int128_t)u * d->v[0] + (__int128_t)v * e->v[0];
+    ce = (__int128_t)q * d->v[0] + (__int128_t)r * e->v[0];
+
+    md -= (int64_t)((mod->modulus_inv62 * (uint64_t)cd + (uint64_t)md) & M62);
+    me -= (int64_t)((mod->modulus_inv62 * (uint64_t)ce + (uint64_t)me) & M62);
+
+    cd += (__int128_t)mv[0] * md;
+    ce += (__int128_t)mv[0] * me;
+    cd >>= 62;
+    ce >>= 62;
+
+    for (int i = 1; i < 5; i++) {
+        cd += (__int128_t)u * d->v[i] + (__int128_t)v * e->v[i];
+        ce += (__int128_t)q * d->v[i] + (__int128_t)r * e->v[i];
+        cd += (__int128_t)mv[i] * md;
+        ce += (__int128_t)mv[i] * me;
+        d->v[i - 1] = (int64_t)((uint64_t)cd & M62);
+        e->v[i - 1] = (int64_t)((uint64_t)ce & M62);
+        cd >>= 62;
+        ce >>= 62;
+    }
+    d->v[4] = (int64_t)cd;
+    e->v[4] = (int64_t)ce;
+}
+
+/* [f, g] <- t·[f, g] / 2^62 over the low len limbs (exact division) */
+static void update_fg(int len, signed62_t *f, signed62_t *g, const trans2x2_t *t) {
+    const int64_t u = t->u, v = t->v, q = t->q, r = t->r;
+    __int128_t cf, cg;
+
+    cf = (__int128_t)u * f->v[0] + (__int128_t)v * g->v[0];
+    cg = (__int128_t)q * f->v[0] + (__int128_t)r * g->v[0];
+    cf >>= 62;
+    cg >>= 62;
+
+    for (int i = 1; i < len; i++) {
+        cf += (__int128_t)u * f->v[i] + (__int128_t)v * g->v[i];
+        cg += (__int128_t)q * f->v[i] + (__int128_t)r * g->v[i];
+        f->v[i - 1] = (int64_t)((uint64_t)cf & M62);
+        g->v[i - 1] = (int64_t)((uint64_t)cg & M62);
+        cf >>= 62;
+        cg >>= 62;
+    }
+    f->v[len - 1] = (int64_t)cf;
+    g->v[len - 1] = (int64_t)cg;
+}
+
+/* r in (-2m, m) -> r·sign(sign) mod m in [0, m), branch-free */
+static void normalize(signed62_t *r, int64_t sign, const safegcd_modinfo_t *mod) {
+    const int64_t *mv = mod->modulus.v;
+    int64_t v[5];
+    volatile int64_t cond_add, cond_negate;
+
+    for (int i = 0; i < 5; i++) v[i] = r->v[i];
+
+    /* Add m if negative, then negate if requested: now in (-m, m) */
+    cond_add = v[4] >> 63;
+    for (int i = 0; i < 5; i++) v[i] += mv[i] & cond_add;
+    cond_negate = sign >> 63;
+    for (int i = 0; i < 5; i++) v[i] = (v[i] ^ cond_negate) - cond_negate;
+    for (int i = 0; i < 4; i++) {
+        v[i + 1] += v[i] >> 62;
+        v[i] &= (int64_t)M62;
+    }
+
+    /* Add m again if still negative: now in [0, m) */
+    cond_add = v[4] >> 63;
+    for (int i = 0; i < 5; i++) v[i] += mv[i] & cond_add;
+    for (int i = 0; i < 4; i++) {
+        v[i + 1] += v[i] >> 62;
+        v[i] &= (int64_t)M62;
+    }
+
+    for (int i = 0; i < 5; i++) r->v[i] = v[i];
+}
+
+void safegcd_inv(signed62_t *x, const safegcd_modinfo_t *mod) {
+    signed62_t d = {{0, 0, 0, 0, 0}};
+    signed62_t e = {{1, 0, 0, 0, 0}};
+    signed62_t f = mod->modulus;
+    signed62_t g = *x;
+    int64_t zeta = -1;
+
+    for (int i = 0; i < 10; i++) {
+        trans2x2_t t;
+        zeta = divsteps_59(zeta, (uint64_t)f.v[0], (uint64_t)g.v[0], &t);
+        update_de(&d, &e, &t, mod);
+        update_fg(5, &f, &g, &t);
+    }
+
+    /* g is now 0 and f = ±1, so d = ±x^-1 */
+    normalize(&d, f.v[4], mod);
+    *x = d;
+}
+
+void safegcd_inv_vartime(signed62_t *x, const safegcd_modinfo_t *mod) {
+    signed62_t d = {{0, 0, 0, 0, 0}};
+    signed62_t e = {{1, 0, 0, 0, 0}};
+    signed62_t f = mod->modulus;
+    signed62_t g = *x;
+    int64_t eta = -1;
+    int len = 5;
+
+    for (;;) {
+        trans2x2_t t;
+        eta = divsteps_62_vartime(eta, (uint64_t)f.v[0], (uint64_t)g.v[0], &t);
+        update_de(&d, &e, &t, mod);
+        update_fg(len, &f, &g, &t);
+
+        if (g.v[0] == 0) {
+            int64_t any = 0;
+            for (int j = 1; j < len; j++) any |= g.v[j];
+            if (any == 0) break;
+        }
+
+        /* Drop the top limb once it is only sign extension in both f and g */
+        int64_t fn = f.v[len - 1], gn = g.v[len - 1];
+        int64_t cond = ((int64_t)len - 2) >> 63;
+        cond |= fn ^ (fn >> 63);
+        cond |= gn ^ (gn >> 63);
+        if (cond == 0) {
+            f.v[len - 2] = (int64_t)((uint64_t)f.v[len - 2] | ((uint64_t)fn << 62));
+            g.v[len - 2] = (int64_t)((uint64_t)g.v[len - 2] | ((uint64_t)gn << 62));
+            len--;
+        }
+    }
+
+    normalize(&d, f.v[len - 1], mod);
+    *x = d;
+}
@@ -0,0 +1,38 @@
+/*
+ * Modular inversion by safegcd (Bernstein-Yang divsteps), internal
+ *
+ * Numbers are five signed 62-bit limbs. Each outer step runs a batch of
+ * divsteps on the low 64 bits of f and g alone, then applies the
+ * resulting 2x2 matrix to the full f, g and to the Bezout coefficients
+ * d, e (kept reduced mod m on the fly). Shared by field.c and scalar.c;
+ * each passes its modulus here.
+ */
+
+#ifndef TETSUO_SAFEGCD_H
+#define TETSUO_SAFEGCD_H
+
+#include <stdint.h>
+
+typedef struct {
+    int64_t v[5];
+} signed62_t;
+
+typedef struct {
+    signed62_t modulus;         /* Odd, below 2^256 */
+    uint64_t modulus_inv62;     /* modulus^-1 mod 2^62 */
+} safegcd_modinfo_t;
+
+/* 4x64-bit little-endian integer <-> signed62 (input must be < 2^256) */
+void signed62_from_u256(signed62_t *r, const uint64_t a[4]);
+void signed62_to_u256(uint64_t r[4], const signed62_t *a);
+
+/*
+ * x <- x^-1 mod m, x in [0, m). 0 maps to 0.
+ * Fixed 10 x 59 divsteps and branch-free matrix steps: constant time.
+ */
+void safegcd_inv(signed62_t *x, const safegcd_modinfo_t *mod);
+
+/* Same result, variable time: stops once g reaches 0. Public data only. */
+void safegcd_inv_vartime(signed62_t *x, const safegcd_modinfo_t *mod);
+
+#endif /* TETSUO_SAFEGCD_H */
@@ -0,0 +1,175 @@
+/*
+ * BN254 scalar field arithmetic - Montgomery form (backend in mont.h)
+ */
+
+#include "scalar.h"
+#include "mont.h"
+#include "safegcd.h"
+#include <string.h>
+
+void fr_add(scalar_t *r, const scalar_t *a, const scalar_t *b) {
+    mont_add_mod(r->limbs, a->limbs, b->limbs, SCALAR_MODULUS);
+}
+
+void fr_sub(scalar_t *r, const scalar_t *a, const scalar_t *b) {
+    mont_sub_mod(r->limbs, a->limbs, b->limbs, SCALAR_MODULUS);
+}
+
+/* Multiply and square kernels, bound at load time (cpu.h) */
+
+typedef void (*fr_mul_fn)(scalar_t *r, const scalar_t *a, const scalar_t *b);
+typedef void (*fr_sqr_fn)(scalar_t *r, const scalar_t *a);
+
+static void fr_mul_c(scalar_t *r, const scalar_t *a, const scalar_t *b) {
+    uint64_t t[8];
+    mont_mul_256x256_c(t, a->limbs, b->limbs);
+    mont_reduce_c(r->limbs, t, SCALAR_MODULUS, SCALAR_INV);
+}
+
+static void fr_sqr_c(scalar_t *r, const scalar_t *a) {
+    uint64_t t[8];
+    mont_sqr_256_c(t, a->limbs);
+    mont_reduce_c(r->limbs, t, SCALAR_MODULUS, SCALAR_INV);
+}
+
+#ifdef TETSUO_X64_ASM
+
+static void fr_mul_adx(scalar_t *r, const scalar_t *a, const scalar_t *b) {
+    uint64_t t[8];
+    mont_mul_256x256_adx(t, a->limbs, b->limbs);
+    mont_reduce_adx(r->limbs, t, SCALAR_MODULUS, SCALAR_INV);
+}
+
+static void fr_sqr_adx(scalar_t *r, const scalar_t *a) {
+    uint64_t t[8];
+    mont_sqr_256_adx(t, a->limbs);
+    mont_reduce_adx(r->limbs, t, SCALAR_MODULUS, SCALAR_INV);
+}
+
+CPU_RESOLVER fr_mul_fn fr_mul_resolve(void) {
+    return (cpu_detect() & CPU_MULX_ADX) == CPU_MULX_ADX ? fr_mul_adx : fr_mul_c;
+}
+
+CPU_RESOLVER fr_sqr_fn fr_sqr_resolve(void) {
+    return (cpu_detect() & CPU_MULX_ADX) == CPU_MULX_ADX ? fr_sqr_adx : fr_sqr_c;
+}
+
+CPU_DISPATCH(fr_mul, (scalar_t *r, const scalar_t *a, const scalar_t *b), (r, a, b),
+             fr_mul_resolve, fr_mul_c)
+CPU_DISPATCH(fr_sqr, (scalar_t *r, const scalar_t *a), (r, a),
+             fr_sqr_resolve, fr_sqr_c)
+
+#else
+
+void fr_mul(scalar_t *r, const scalar_t *a, const scalar_t *b) {
+    fr_mul_c(r, a, b);
+}
+
+void fr_sqr(scalar_t *r, const scalar_t *a) {
+    fr_sqr_c(r, a);
+}
+
+#endif /* TETSUO_X64_ASM */
+
+void fr_neg(scalar_t *r, const scalar_t *a) {
+    if (fr_is_zero(a)) {
+        fr_set_zero(r);
+    } else {
+        mont_sub_256(r->limbs, SCALAR_MODULUS, a->limbs);
+    }
+}
+
+/* safegcd inversion, then ×R³ back into Montgomery form (see field_inv) */
+static const safegcd_modinfo_t SCALAR_MODINFO = {
+    {{0x03E1F593F0000001LL, 0x20CFA121E6E5C245LL, 0x05045B68181585D2LL,
+      0x19139CB84C680A6ELL, 0x30LL}},
+    0x3D1E0A6C10000001ULL
+};
+
+/* R³ mod r */
+static const scalar_t SCALAR_R3 = {{
+    0x5E94D8E1B4BF0040ULL,
+    0x2A489CBE1CFBB6B8ULL,
+    0x893CC664A19FCFEDULL,
+    0x0CF8594B7FCC657CULL
+}};
+
+void fr_inv(scalar_t *r, const scalar_t *a) {
+    signed62_t x;
+    signed62_from_u256(&x, a->limbs);
+    safegcd_inv(&x, &SCALAR_MODINFO);
+    signed62_to_u256(r->limbs, &x);
+    fr_mul(r, r, &SCALAR_R3);
+}
+
+void fr_to_mont(scalar_t *r, const scalar_t *a) {
+    fr_mul(r, a, (const scalar_t *)SCALAR_R2);
+}
+
+void fr_from_mont(scalar_t *r, const scalar_t *a) {
+    uint64_t t[8] = {a->limbs[0], a->limbs[1], a->limbs[2], a->limbs[3], 0, 0, 0, 0};
+    mont_reduce_c(r->limbs, t, SCALAR_MODULUS, SCALAR_INV);
+}
+
+void fr_from_field(scalar_t *r, const field_t *a) {
+    field_t canon;
+    field_from_mont(&canon, a);
+
+    /* p < 2r, so one conditional subtraction reduces mod r */
+    uint64_t tmp[4];
+    uint64_t borrow = mont_sub_256(tmp, canon.limbs, SCALAR_MODULUS);
+    uint64_t mask = borrow - 1;
+    for (int i = 0; i < 4; i++) {
+        r->limbs[i] = (canon.limbs[i] & ~mask) | (tmp[i] & mask);
+    }
+    fr_to_mont(r, r);
+}
+
+void fr_from_u64(scalar_t *r, uint64_t v) {
+    r->limbs[0] = v;
+    r->limbs[1] = r->limbs[2] = r->limbs[3] = 0;
+    fr_to_mont(r, r);
+}
+
+bool fr_eq(const scalar_t *a, const scalar_t *b) {
+    uint64_t diff = 0;
+    diff |= a->limbs[0] ^ b->limbs[0];
+    diff |= a->limbs[1] ^ b->limbs[1];
+    diff |= a->limbs[2] ^ b->limbs[2];
+    diff |= a->limbs[3] ^ b->limbs[3];
+    return diff == 0;
+}
+
+bool fr_is_zero(const scalar_t *a) {
+    return (a->limbs[0] | a->limbs[1] | a->limbs[2] | a->limbs[3]) == 0;
+}
+
+void fr_set_zero(scalar_t *r) {
+    r->limbs[0] = r->limbs[1] = r->limbs[2] = r->limbs[3] = 0;
+}
+
+void fr_set_one(scalar_t *r) {
+    r->limbs[0] = SCALAR_R[0];
+    r->limbs[1] = SCALAR_R[1];
+    r->limbs[2] = SCALAR_R[2];
+    r->limbs[3] = SCALAR_R[3];
+}
+
+void fr_copy(scalar_t *r, const scalar_t *a) {
+    r->limbs[0] = a->limbs[0];
+    r->limbs[1] = a->limbs[1];
+    r->limbs[2] = a->limbs[2];
+    r->limbs[3] = a->limbs[3];
+}
+
+void fr_from_bytes(scalar_t *r, const uint8_t *bytes) {
+    field_t tmp;
+    field_from_bytes(&tmp, bytes);
+    memcpy(r->limbs, tmp.limbs, sizeof(r->limbs));
+}
+
+void fr_to_bytes(uint8_t *bytes, const scalar_t *a) {
+    field_t tmp;
+    memcpy(tmp.limbs, a->limbs, sizeof(tmp.limbs));
+    field_to_bytes(bytes, &tmp);
+}
@@ -0,0 +1,79 @@
+/*
+ * BN254 scalar field arithmetic
+ *
+ * Montgomery representation over the group order, same backend as field.h.
+ * r = 21888242871839275222246405745257275088548364400416034343698204186575808495617
+ */
+
+#ifndef TETSUO_SCALAR_H
+#define TETSUO_SCALAR_H
+
+#include "field.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Scalar field modulus r (G1/G2 group order) */
+static const uint64_t SCALAR_MODULUS[4] = {
+    0x43E1F593F0000001ULL,
+    0x2833E84879B97091ULL,
+    0xB85045B68181585DULL,
+    0x30644E72E131A029ULL
+};
+
+/* Montgomery constant R = 2^256 mod r */
+static const uint64_t SCALAR_R[4] = {
+    0xAC96341C4FFFFFFBULL,
+    0x36FC76959F60CD29ULL,
+    0x666EA36F7879462EULL,
+    0x0E0A77C19A07DF2FULL
+};
+
+/* R² mod r for toMont conversion */
+static const uint64_t SCALAR_R2[4] = {
+    0x1BB8E645AE216DA7ULL,
+    0x53FE3AB1E35C59E3ULL,
+    0x8C49833D53BB8085ULL,
+    0x0216D0B17F4E44A5ULL
+};
+
+/* Montgomery reduction constant: -r⁻¹ mod 2⁶⁴ */
+static const uint64_t SCALAR_INV = 0xC2E1F593EFFFFFFFULL;
+
+/*
+ * Same limb layout as mcl's mclBnFr, so Montgomery-form scalars pass
+ * to mcl without conversion.
+ */
+typedef struct {
+    uint64_t limbs[4];
+} scalar_t;
+
+/* Core scalar operations */
+void fr_add(scalar_t *r, const scalar_t *a, const scalar_t *b);
+void fr_sub(scalar_t *r, const scalar_t *a, const scalar_t *b);
+void fr_mul(scalar_t *r, const scalar_t *a, const scalar_t *b);
+void fr_sqr(scalar_t *r, const scalar_t *a);
+void fr_inv(scalar_t *r, const scalar_t *a);
+void fr_neg(scalar_t *r, const scalar_t *a);
+
+/* Montgomery conversion */
+void fr_to_mont(scalar_t *r, const scalar_t *a);
+void fr_from_mont(scalar_t *r, const scalar_t *a);
+
+/* Canonical Fp value (field_t in Montgomery form) reduced mod r */
+void fr_from_field(scalar_t *r, const field_t *a);
+
+/* Small integer, result in Montgomery form */
+void fr_from_u64(scalar_t *r, uint64_t v);
+
+/* Utility */
+bool fr_eq(const scalar_t *a, const scalar_t *b);
+bool fr_is_zero(const scalar_t *a);
+void fr_set_zero(scalar_t *r);
+void fr_set_one(scalar_t *r);
+void fr_copy(scalar_t *r, const scalar_t *a);
+
+/* Serialization (big-endian canonical, matches field_to_bytes) */
+void fr_from_bytes(scalar_t *r, const uint8_t *bytes);
+void fr_to_bytes(uint8_t *bytes, const scalar_t *a);
+
+#endif /* TETSUO_SCALAR_H */
@@ -0,0 +1,30 @@
+/*
+ * SHA-256 (FIPS 180-4)
+ *
+ * Streaming interface for batch transcripts. Not constant-time with
+ * respect to message length; inputs hashed here are public.
+ */
+
+#ifndef TETSUO_SHA256_H
+#define TETSUO_SHA256_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SHA256_DIGEST_SIZE 32
+
+typedef struct {
+    uint32_t h[8];
+    uint8_t buf[64];
+    size_t buf_len;
+    uint64_t total_len;
+} sha256_ctx_t;
+
+void sha256_init(sha256_ctx_t *ctx);
+void sha256_update(sha256_ctx_t *ctx, const void *data, size_t len);
+void sha256_final(sha256_ctx_t *ctx, uint8_t out[SHA256_DIGEST_SIZE]);
+
+/* One-shot digest */
+void sha256(uint8_t out[SHA256_DIGEST_SIZE], const void *data, size_t len);
+
+#endif /* TETSUO_SHA256_H */
@@ -51,6 +51,12 @@ typedef enum {
     TETSUO_PROOF_INFERENCE = 2,
 } tetsuo_proof_type_t;
 
+/* Batch coefficient source */
+typedef enum {
+    TETSUO_BATCH_COEFFS_RANDOM = 0,      /* OS-seeded CSPRNG (default) */
+    TETSUO_BATCH_COEFFS_TRANSCRIPT = 1,  /* Hash of the batch: no RNG, replayable */
+} tetsuo_batch_coeffs_t;
+
 /*
  * Wire format for proofs (330 bytes total)
  *
@@ -78,6 +84,8 @@ typedef struct {
     uint8_t blacklist_root[32];  /* SMT root for blacklist */
     const uint8_t *vk_data;      /* Verification key bytes */
     size_t vk_len;               /* Verification key length */
+    uint32_t num_threads;        /* Batch verification threads (0/1 = caller only) */
+    tetsuo_batch_coeffs_t batch_coeffs;  /* Batch coefficient source */
 } tetsuo_config_t;
 
 /* Verification statistics */
@@ -179,6 +187,18 @@ TETSUO_API void tetsuo_batch_destroy(tetsuo_batch_t *batch);
  */
 TETSUO_API void tetsuo_get_stats(tetsuo_ctx_t *ctx, tetsuo_stats_t *stats);
 
+/* Kernels selected for this CPU, see tetsuo_cpu_features() */
+typedef enum {
+    TETSUO_CPU_MULX_ADX = 1 << 0,       /* Fp/Fr multiply with MULX/ADCX/ADOX */
+    TETSUO_CPU_AVX512_IFMA = 1 << 1,    /* 8-lane batch field ops and Poseidon */
+} tetsuo_cpu_feature_t;
+
+/*
+ * Which optimized kernels this process is running (tetsuo_cpu_feature_t
+ * bits). 0 means the portable C kernels throughout.
+ */
+TETSUO_API uint32_t tetsuo_cpu_features(void);
+
 /*
  * Utility: Create proof from components
  */
@@ -0,0 +1,299 @@
+/*
+ * Work-stealing thread pool - pthreads backend.
+ *
+ * Each thread owns a deque of chunk indices. Owners pop from the front,
+ * thieves take from the back, so stolen work is the part the owner would
+ * reach last. Deques are short-lived ranges guarded by a per-deque mutex;
+ * chunks are coarse enough that the lock is never the bottleneck.
+ */
+
+#include "threadpool.h"
+#include "arena.h"
+#include "rng.h"
+#include "log.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+/* Same chunking as the pool, in order on the calling thread */
+static void run_inline(size_t n, size_t grain, threadpool_fn fn, void *arg) {
+    for (size_t lo = 0; lo < n; lo += grain) {
+        fn(arg, lo, n - lo < grain ? n : lo + grain);
+    }
+}
+
+#ifndef _WIN32
+
+typedef struct {
+    threadpool_fn fn;
+    void *arg;
+    size_t n;
+    size_t grain;
+    _Atomic(size_t) pending;    /* Chunks not yet finished */
+} job_t;
+
+typedef struct {
+    _Alignas(CACHE_LINE_SIZE) pthread_mutex_t lock;
+    job_t *job;
+    size_t lo, hi;              /* Chunk indices [lo, hi) */
+} deque_t;
+
+struct threadpool {
+    size_t num_threads;         /* Including the caller */
+    size_t num_workers;         /* Started worker threads */
+    pthread_t *workers;
+    deque_t *deques;
+
+    pthread_mutex_t submit_lock;    /* One loop at a time */
+
+    pthread_mutex_t wake_lock;
+    pthread_cond_t wake;
+    uint64_t generation;
+    bool shutdown;
+
+    pthread_mutex_t done_lock;
+    pthread_cond_t done;
+};
+
+typedef struct {
+    threadpool_t *pool;
+    size_t id;
+} worker_arg_t;
+
+static bool take_chunk(deque_t *d, bool steal, job_t **job, size_t *chunk) {
+    bool found = false;
+    pthread_mutex_lock(&d->lock);
+    if (d->lo < d->hi) {
+        *chunk = steal ? --d->hi : d->lo++;
+        *job = d->job;
+        found = true;
+    }
+    pthread_mutex_unlock(&d->lock);
+    return found;
+}
+
+static void run_chunk(threadpool_t *pool, job_t *job, size_t chunk) {
+    size_t begin = chunk * job->grain;
+    size_t end = begin + job->grain;
+    if (end > job->n) end = job->n;
+
+    job->fn(job->arg, begin, end);
+
+    if (atomic_fetch_sub(&job->pending, 1) == 1) {
+        pthread_mutex_lock(&pool->done_lock);
+        pthread_cond_broadcast(&pool->done);
+        pthread_mutex_unlock(&pool->done_lock);
+    }
+}
+
+/* Drain own deque, then steal until every deque is empty */
+static void work(threadpool_t *pool, size_t id) {
+    job_t *job;
+    size_t chunk;
+
+    for (;;) {
+        if (take_chunk(&pool->deques[id], false, &job, &chunk)) {
+            run_chunk(pool, job, chunk);
+            continue;
+        }
+
+        bool stole = false;
+        for (size_t k = 1; k < pool->num_threads; k++) {
+            size_t victim = (id + k) % pool->num_threads;
+            if (take_chunk(&pool->deques[victim], true, &job, &chunk)) {
+                run_chunk(pool, job, chunk);
+                stole = true;
+                break;
+            }
+        }
+        if (!stole) return;
+    }
+}
+
+static void *worker_main(void *p) {
+    worker_arg_t *wa = p;
+    threadpool_t *pool = wa->pool;
+    size_t id = wa->id;
+    free(wa);
+
+    uint64_t seen = 0;
+    for (;;) {
+        pthread_mutex_lock(&pool->wake_lock);
+        while (!pool->shutdown && pool->generation == seen) {
+            pthread_cond_wait(&pool->wake, &pool->wake_lock);
+        }
+        if (pool->shutdown) {
+            pthread_mutex_unlock(&pool->wake_lock);
+            break;
+        }
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->wake_lock);
+
+        work(pool, id);
+    }
+
+    /* Worker-owned scratch arena and RNG state */
+    scratch_arena_destroy();
+    rng_thread_wipe();
+    return NULL;
+}
+
+threadpool_t *threadpool_create(size_t num_threads) {
+    if (num_threads <= 1) return NULL;
+
+    threadpool_t *pool = calloc(1, sizeof(threadpool_t));
+    if (!pool) return NULL;
+
+    pool->num_threads = num_threads;
+    pool->workers = calloc(num_threads - 1, sizeof(pthread_t));
+    pool->deques = aligned_alloc(CACHE_LINE_SIZE,
+                                 ((num_threads * sizeof(deque_t) + CACHE_LINE_SIZE - 1) /
+                                  CACHE_LINE_SIZE) * CACHE_LINE_SIZE);
+    if (!pool->workers || !pool->deques) {
+        free(pool->workers);
+        free(pool->deques);
+        free(pool);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < num_threads; i++) {
+        pthread_mutex_init(&pool->deques[i].lock, NULL);
+        pool->deques[i].job = NULL;
+        pool->deques[i].lo = pool->deques[i].hi = 0;
+    }
+    pthread_mutex_init(&pool->submit_lock, NULL);
+    pthread_mutex_init(&pool->wake_lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_mutex_init(&pool->done_lock, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    size_t started = 0;
+    for (size_t i = 1; i < num_threads; i++) {
+        worker_arg_t *wa = malloc(sizeof(worker_arg_t));
+        if (!wa) break;
+        wa->pool = pool;
+        wa->id = i;
+        if (pthread_create(&pool->workers[i - 1], NULL, worker_main, wa) != 0) {
+            free(wa);
+            break;
+        }
+        pool->num_workers = ++started;
+    }
+
+    if (started != num_threads - 1) {
+        LOG_ERROR("threadpool_create: started %zu of %zu workers",
+                  started, num_threads - 1);
+        threadpool_destroy(pool);
+        return NULL;
+    }
+
+    LOG_DEBUG("threadpool_create: %zu threads", num_threads);
+    return pool;
+}
+
+void threadpool_destroy(threadpool_t *pool) {
+    if (!pool) return;
+
+    pthread_mutex_lock(&pool->wake_lock);
+    pool->shutdown = true;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->wake_lock);
+
+    for (size_t i = 0; i < pool->num_workers; i++) {
+        pthread_join(pool->workers[i], NULL);
+    }
+
+    for (size_t i = 0; i < pool->num_threads; i++) {
+        pthread_mutex_destroy(&pool->deques[i].lock);
+    }
+    pthread_mutex_destroy(&pool->submit_lock);
+    pthread_mutex_destroy(&pool->wake_lock);
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->done_lock);
+    pthread_cond_destroy(&pool->done);
+
+    free(pool->workers);
+    free(pool->deques);
+    free(pool);
+}
+
+size_t threadpool_size(const threadpool_t *pool) {
+    return pool ? pool->num_threads : 1;
+}
+
+void threadpool_for(threadpool_t *pool, size_t n, size_t grain,
+                    threadpool_fn fn, void *arg) {
+    if (n == 0) return;
+    if (grain == 0) grain = 1;
+
+    size_t chunks = (n + grain - 1) / grain;
+    if (!pool || chunks == 1) {
+        run_inline(n, grain, fn, arg);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->submit_lock);
+
+    job_t job = { .fn = fn, .arg = arg, .n = n, .grain = grain };
+    atomic_store(&job.pending, chunks);
+
+    /* Contiguous runs per thread keep neighbouring chunks on one core */
+    size_t per = chunks / pool->num_threads;
+    size_t extra = chunks % pool->num_threads;
+    size_t next = 0;
+    for (size_t i = 0; i < pool->num_threads; i++) {
+        size_t take = per + (i < extra ? 1 : 0);
+        pthread_mutex_lock(&pool->deques[i].lock);
+        pool->deques[i].job = &job;
+        pool->deques[i].lo = next;
+        pool->deques[i].hi = next + take;
+        pthread_mutex_unlock(&pool->deques[i].lock);
+        next += take;
+    }
+
+    pthread_mutex_lock(&pool->wake_lock);
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->wake_lock);
+
+    work(pool, 0);
+
+    pthread_mutex_lock(&pool->done_lock);
+    while (atomic_load(&job.pending) != 0) {
+        pthread_cond_wait(&pool->done, &pool->done_lock);
+    }
+    pthread_mutex_unlock(&pool->done_lock);
+
+    pthread_mutex_unlock(&pool->submit_lock);
+}
+
+#else /* _WIN32 */
+
+/* No worker threads on Windows yet: loops run on the calling thread */
+
+threadpool_t *threadpool_create(size_t num_threads) {
+    (void)num_threads;
+    return NULL;
+}
+
+void threadpool_destroy(threadpool_t *pool) {
+    (void)pool;
+}
+
+size_t threadpool_size(const threadpool_t *pool) {
+    (void)pool;
+    return 1;
+}
+
+void threadpool_for(threadpool_t *pool, size_t n, size_t grain,
+                    threadpool_fn fn, void *arg) {
+    (void)pool;
+    if (grain == 0) grain = 1;
+    run_inline(n, grain, fn, arg);
+}
+
+#endif /* _WIN32 */
@@ -0,0 +1,42 @@
+/*
+ * Work-stealing thread pool
+ *
+ * Fork-join parallel loops for batch verification. The calling thread
+ * takes part in every loop, so a pool of N threads starts N - 1 workers.
+ */
+
+#ifndef TETSUO_THREADPOOL_H
+#define TETSUO_THREADPOOL_H
+
+#include <stddef.h>
+
+typedef struct threadpool threadpool_t;
+
+/* Loop body: process indices [begin, end) */
+typedef void (*threadpool_fn)(void *arg, size_t begin, size_t end);
+
+/*
+ * Create a pool of num_threads threads including the caller.
+ * Returns NULL for num_threads <= 1 or on failure; every function here
+ * accepts a NULL pool and then runs on the calling thread.
+ */
+threadpool_t *threadpool_create(size_t num_threads);
+void threadpool_destroy(threadpool_t *pool);
+
+/* Threads taking part in a loop (1 for a NULL pool) */
+size_t threadpool_size(const threadpool_t *pool);
+
+/*
+ * Run fn over [0, n) in chunks of `grain` indices and return when all
+ * chunks are done. fn never sees more than one chunk per call, with or
+ * without a pool (a NULL pool runs the chunks in order on the calling
+ * thread), so per-chunk output slots can be indexed by begin / grain.
+ * Each thread's deque starts with a contiguous run of
+ * chunks; idle threads steal from the far end of other deques. One loop
+ * runs at a time per pool (concurrent callers are serialised), so a loop
+ * body must not call threadpool_for on the same pool.
+ */
+void threadpool_for(threadpool_t *pool, size_t n, size_t grain,
+                    threadpool_fn fn, void *arg);
+
+#endif /* TETSUO_THREADPOOL_H */
@@ -9,69 +9,30 @@
 #include "pairing.h"
 #include "log.h"
 #include "error.h"
-#include "poseidon_constants.h"
+#include "poseidon_tables.h"
+#include "poseidon_simd.h"
 #include <string.h>
-#include <fcntl.h>
-#include <unistd.h>
+#include <stdatomic.h>
 #include <stdio.h>
 
-#ifdef _WIN32
-#include <windows.h>
-#include <bcrypt.h>
-#pragma comment(lib, "bcrypt.lib")
-#endif
-
-/*
- * Poseidon MDS matrix (t=3, circomlib compatible)
- * Cauchy construction ensures maximum distance separability.
- * Limbs are little-endian.
- */
-static const uint64_t POSEIDON_MDS[3][3][4] = {
-    {{0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL},
-     {0x2e2419f9ec02ec39ULL, 0x85045b68181585d9ULL, 0x30644e72e131a029ULL, 0x0000000000000001ULL},
-     {0x3c208c16d87cfd46ULL, 0x97816a916871ca8dULL, 0xb85045b68181585dULL, 0x30644e72e131a029ULL}},
-    {{0x2e2419f9ec02ec39ULL, 0x85045b68181585d9ULL, 0x30644e72e131a029ULL, 0x0000000000000001ULL},
-     {0x3c208c16d87cfd46ULL, 0x97816a916871ca8dULL, 0xb85045b68181585dULL, 0x30644e72e131a029ULL},
-     {0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL}},
-    {{0x3c208c16d87cfd46ULL, 0x97816a916871ca8dULL, 0xb85045b68181585dULL, 0x30644e72e131a029ULL},
-     {0x109b7f411ba0e4c9ULL, 0xd69b5a8127c15fe0ULL, 0x58d3f7e5e3d7a5b9ULL, 0x0b85cda6a5f9a9ddULL},
-     {0x2e2419f9ec02ec39ULL, 0x85045b68181585d9ULL, 0x30644e72e131a029ULL, 0x0000000000000001ULL}}
-};
-
-static bool get_random_bytes(uint8_t *buf, size_t len) {
-#ifdef _WIN32
-    return BCryptGenRandom(NULL, buf, (ULONG)len, BCRYPT_USE_SYSTEM_PREFERRED_RNG) == 0;
-#else
-    int fd = open("/dev/urandom", O_RDONLY);
-    if (fd < 0) return false;
-    ssize_t n = read(fd, buf, len);
-    close(fd);
-    return n == (ssize_t)len;
-#endif
-}
-
 /*
  * Poseidon parameters: t=3, α=5, R_F=8, R_P=57
  * TaceoLabs-optimized constants (171 total).
+ *
+ * The 57 rounds run as 4 full, 49 partial and 4 full. Partial rounds use
+ * the optimized-Poseidon form (Poseidon paper, appendix B): their round
+ * constants are folded down to one scalar on state[0], and the MDS matrix
+ * is factored into sparse matrices, so a partial round costs 5 field_mul
+ * for the linear layer instead of 9. The output is bit-identical to the
+ * plain ARK -> S-box -> MDS round function.
+ *
+ * All tables are precomputed in Montgomery form by
+ * tools/gen_poseidon_tables.c and live in .rodata (poseidon_tables.h).
  */
 #define POSEIDON_T 3
 #define POSEIDON_R_F 8       /* Full rounds (4 at start, 4 at end) */
 #define POSEIDON_R_P 57      /* Partial rounds */
 
-/* Cached round constants (initialized once) */
-static field_t g_poseidon_rc[171];
-static bool g_poseidon_initialized = false;
-
-static void poseidon_init_constants(void) {
-    if (g_poseidon_initialized) return;
-
-    for (int i = 0; i < 171; i++) {
-        hex_to_field(&g_poseidon_rc[i], POSEIDON_RC_HEX[i]);
-        field_to_mont(&g_poseidon_rc[i], &g_poseidon_rc[i]);
-    }
-    g_poseidon_initialized = true;
-}
-
 static void sbox(field_t *x) {
     /* x^5 S-box: x -> x^5 */
     field_t t, t2;
@@ -80,29 +41,37 @@ static void sbox(field_t *x) {
     field_mul(x, &t2, x);  /* x^5 */
 }
 
-static void mds_mix(field_t state[3]) {
+static void mds_mix(field_t state[3], const field_t m[3][3]) {
     field_t tmp[3];
     for (int j = 0; j < 3; j++) {
-        field_set_zero(&tmp[j]);
-        for (int k = 0; k < 3; k++) {
-            field_t m, prod;
-            m.limbs[0] = POSEIDON_MDS[j][k][0];
-            m.limbs[1] = POSEIDON_MDS[j][k][1];
-            m.limbs[2] = POSEIDON_MDS[j][k][2];
-            m.limbs[3] = POSEIDON_MDS[j][k][3];
-            field_mul(&prod, &m, &state[k]);
-            field_add(&tmp[j], &tmp[j], &prod);
-        }
+        field_sum_of_products(&tmp[j], m[j], state, 3);
     }
     state[0] = tmp[0];
     state[1] = tmp[1];
     state[2] = tmp[2];
 }
 
+static void sparse_mix(field_t state[3], const poseidon_sparse_t *sp) {
+    field_t s0, prod;
+    field_sum_of_products(&s0, sp->w, state, 3);
+
+    field_mul(&prod, &sp->v[0], &state[0]);
+    field_add(&state[1], &state[1], &prod);
+    field_mul(&prod, &sp->v[1], &state[0]);
+    field_add(&state[2], &state[2], &prod);
+    state[0] = s0;
+}
+
+static void full_round(field_t state[3], const field_t rc[3]) {
+    for (int j = 0; j < POSEIDON_T; j++) {
+        field_add(&state[j], &state[j], &rc[j]);
+        sbox(&state[j]);
+    }
+    mds_mix(state, POSEIDON_MDS_MONT);
+}
+
 /* Poseidon sponge: 4 full + 49 partial + 4 full rounds */
 static void poseidon_hash(field_t *out, const field_t *inputs, size_t count) {
-    poseidon_init_constants();
-
     field_t state[3];
     field_set_zero(&state[0]);
     field_set_zero(&state[1]);
@@ -113,32 +82,54 @@ static void poseidon_hash(field_t *out, const field_t *inputs, size_t count) {
         field_add(&state[i], &state[i], &inputs[i]);
     }
 
-    int rc_idx = 0;
-    const int num_rounds = 57;
-    const int full_rounds_half = 4;  /* 4 at start, 4 at end */
+    for (int r = 0; r < POSEIDON_HALF_FULL; r++) {
+        full_round(state, POSEIDON_FULL_RC[r]);
+    }
 
-    for (int r = 0; r < num_rounds; r++) {
-        /* ARK: Add round constants to all elements */
-        for (int j = 0; j < POSEIDON_T; j++) {
-            field_add(&state[j], &state[j], &g_poseidon_rc[rc_idx++]);
-        }
+    /* Partial rounds: scalar constant, S-box on state[0], sparse mix */
+    for (int r = 0; r < POSEIDON_PARTIAL - 1; r++) {
+        field_add(&state[0], &state[0], &POSEIDON_PARTIAL_RC[r]);
+        sbox(&state[0]);
+        sparse_mix(state, &POSEIDON_SPARSE[r]);
+    }
+    field_add(&state[0], &state[0], &POSEIDON_PARTIAL_RC[POSEIDON_PARTIAL - 1]);
+    sbox(&state[0]);
+    mds_mix(state, POSEIDON_MDS_LAST);
 
-        /* S-box: Full rounds at start and end, partial in middle */
-        if (r < full_rounds_half || r >= num_rounds - full_rounds_half) {
-            /* Full round: S-box on all elements */
-            for (int j = 0; j < POSEIDON_T; j++) {
-                sbox(&state[j]);
-            }
-        } else {
-            /* Partial round: S-box only on first element */
-            sbox(&state[0]);
+    for (int r = POSEIDON_HALF_FULL; r < 2 * POSEIDON_HALF_FULL; r++) {
+        full_round(state, POSEIDON_FULL_RC[r]);
+    }
+
+    field_copy(out, &state[0]);
+}
+
+/*
+ * n independent hashes. Full groups of lanes go through the IFMA kernel
+ * when the CPU has it; a remainder of three or more is padded into one
+ * more kernel call, smaller ones run on the scalar permutation.
+ */
+void poseidon_hash_many(field_t *out, const field_t *inputs, size_t arity, size_t n) {
+    size_t i = 0;
+
+    if (arity > 0 && field_ifma_available()) {
+        for (; i + FIELD_IFMA_LANES <= n; i += FIELD_IFMA_LANES) {
+            poseidon_hash_ifma8(&out[i], &inputs[i * arity], arity);
         }
 
-        /* MDS mix */
-        mds_mix(state);
+        size_t rem = n - i;
+        if (rem >= 3 && arity <= 3) {
+            field_t in[FIELD_IFMA_LANES * 3], res[FIELD_IFMA_LANES];
+            memset(in, 0, sizeof(in));
+            memcpy(in, &inputs[i * arity], rem * arity * sizeof(field_t));
+            poseidon_hash_ifma8(res, in, arity);
+            memcpy(&out[i], res, rem * sizeof(field_t));
+            i = n;
+        }
     }
 
-    field_copy(out, &state[0]);
+    for (; i < n; i++) {
+        poseidon_hash(&out[i], &inputs[i * arity], arity);
+    }
 }
 
 /* Public Poseidon hash for agenc_zk module */
@@ -154,50 +145,51 @@ static const uint64_t CURVE_B_MONT[4] = {
     0x2a1f6744ce179d8eULL
 };
 
-static void point_set_infinity(point_t *p) {
+void point_set_infinity(point_t *p) {
     field_set_zero(&p->x);
     field_set_one(&p->y);
     field_set_zero(&p->z);
 }
 
-static bool point_is_infinity(const point_t *p) {
+bool point_is_infinity(const point_t *p) {
     return field_is_zero(&p->z);
 }
 
 /*
  * Verify point is on BN254 curve: y² = x³ + 3
- * For projective coordinates: Y²Z = X³ + 3Z³
+ * For Jacobian coordinates (x = X/Z², y = Y/Z³): Y² = X³ + 3Z⁶
  */
 static bool point_is_on_curve(const point_t *p) {
     if (point_is_infinity(p)) {
         return true;  /* Point at infinity is valid */
     }
 
-    field_t lhs, rhs, tmp, z2, z3;
+    field_t lhs, rhs, tmp, z2, z6;
     field_t b;
     b.limbs[0] = CURVE_B_MONT[0];
     b.limbs[1] = CURVE_B_MONT[1];
     b.limbs[2] = CURVE_B_MONT[2];
     b.limbs[3] = CURVE_B_MONT[3];
 
-    /* LHS = Y² * Z */
+    /* LHS = Y² */
     field_sqr(&lhs, &p->y);
-    field_mul(&lhs, &lhs, &p->z);
 
-    /* RHS = X³ + 3*Z³ */
+    /* RHS = X³ + 3*Z⁶ */
     field_sqr(&tmp, &p->x);
     field_mul(&rhs, &tmp, &p->x);  /* X³ */
 
     field_sqr(&z2, &p->z);
-    field_mul(&z3, &z2, &p->z);    /* Z³ */
-    field_mul(&tmp, &b, &z3);      /* 3*Z³ (b=3 in curve equation) */
+    field_sqr(&z6, &z2);
+    field_mul(&z6, &z6, &z2);      /* Z⁶ */
+    field_mul(&tmp, &b, &z6);      /* 3*Z⁶ (b=3 in curve equation) */
 
-    field_add(&rhs, &rhs, &tmp);   /* X³ + 3*Z³ */
+    field_add(&rhs, &rhs, &tmp);   /* X³ + 3*Z⁶ */
 
-    return field_eq(&lhs, &rhs);
+    return field_eq_vartime(&lhs, &rhs);
 }
 
-static void point_double(point_t *r, const point_t *p) {
+/* dbl-2009-l: a = 0 Jacobian doubling, 2M + 5S */
+void point_double(point_t *r, const point_t *p) {
     if (point_is_infinity(p)) {
         *r = *p;
         return;
@@ -220,6 +212,10 @@ static void point_double(point_t *r, const point_t *p) {
 
     field_sqr(&f, &e);
 
+    /* Z3 first: r may alias p */
+    field_mul(&r->z, &p->y, &p->z);
+    field_add(&r->z, &r->z, &r->z);
+
     field_sub(&r->x, &f, &d);
     field_sub(&r->x, &r->x, &d);
 
@@ -229,12 +225,9 @@ static void point_double(point_t *r, const point_t *p) {
     field_add(&c, &c, &c);
     field_add(&c, &c, &c);
     field_sub(&r->y, &r->y, &c);
-
-    field_mul(&r->z, &p->y, &p->z);
-    field_add(&r->z, &r->z, &r->z);
 }
 
-static void point_add(point_t *r, const point_t *p, const point_t *q) {
+void point_add(point_t *r, const point_t *p, const point_t *q) {
     if (point_is_infinity(p)) { *r = *q; return; }
     if (point_is_infinity(q)) { *r = *p; return; }
 
@@ -253,7 +246,7 @@ static void point_add(point_t *r, const point_t *p, const point_t *q) {
 
     field_sub(&h, &u2, &u1);
 
-    if (field_is_zero(&h) && field_eq(&s1, &s2)) {
+    if (field_is_zero(&h) && field_eq_vartime(&s1, &s2)) {
         point_double(r, p);
         return;
     }
@@ -273,11 +266,14 @@ static void point_add(point_t *r, const point_t *p, const point_t *q) {
     field_sub(&r->x, &r->x, &v);
     field_sub(&r->x, &r->x, &v);
 
-    field_sub(&r->y, &v, &r->x);
-    field_mul(&r->y, &r->y, &rr);
-    field_mul(&s1, &s1, &j);
-    field_add(&s1, &s1, &s1);
-    field_sub(&r->y, &r->y, &s1);
+    /* Y3 = rr·(V - X3) - S1·2J, reduced once */
+    field_wide_t y3, s1j;
+    field_sub(&v, &v, &r->x);
+    field_wide_mul(&y3, &rr, &v);
+    field_add(&j, &j, &j);
+    field_wide_mul(&s1j, &s1, &j);
+    field_wide_sub(&y3, &y3, &s1j);
+    field_wide_reduce(&r->y, &y3);
 
     field_add(&r->z, &p->z, &q->z);
     field_sqr(&r->z, &r->z);
@@ -286,17 +282,73 @@ static void point_add(point_t *r, const point_t *p, const point_t *q) {
     field_mul(&r->z, &r->z, &h);
 }
 
-/* Scalar multiplication (Montgomery ladder, constant-time). Retained for non-mcl builds. */
-static void __attribute__((unused)) point_mul(point_t *r, const point_t *p, const field_t *scalar) {
+/*
+ * madd-2007-bl: q affine (Z = 1) or infinity, 7M + 4S against 11M + 5S
+ * for point_add. H = 0 with S2 != Y1 (q = -p) falls out as Z3 = 0.
+ */
+void point_add_affine(point_t *r, const point_t *p, const point_t *q) {
+    if (point_is_infinity(q)) { *r = *p; return; }
+    if (point_is_infinity(p)) { *r = *q; return; }
+
+    field_t z1z1, u2, s2, h, hh, i, j, rr, v;
+
+    field_sqr(&z1z1, &p->z);
+    field_mul(&u2, &q->x, &z1z1);
+    field_mul(&s2, &q->y, &p->z);
+    field_mul(&s2, &s2, &z1z1);
+
+    field_sub(&h, &u2, &p->x);
+    field_sub(&rr, &s2, &p->y);
+
+    if (field_is_zero(&h) && field_is_zero(&rr)) {
+        point_double(r, q);
+        return;
+    }
+
+    field_sqr(&hh, &h);
+    field_add(&i, &hh, &hh);
+    field_add(&i, &i, &i);
+    field_mul(&j, &h, &i);
+    field_add(&rr, &rr, &rr);
+    field_mul(&v, &p->x, &i);
+
+    /* Z3 first: r may alias p */
+    field_add(&r->z, &p->z, &h);
+    field_sqr(&r->z, &r->z);
+    field_sub(&r->z, &r->z, &z1z1);
+    field_sub(&r->z, &r->z, &hh);
+
+    field_sqr(&r->x, &rr);
+    field_sub(&r->x, &r->x, &j);
+    field_sub(&r->x, &r->x, &v);
+    field_sub(&r->x, &r->x, &v);
+
+    /* Y3 = rr·(V - X3) - Y1·2J, reduced once */
+    field_wide_t y3, y1j;
+    field_sub(&v, &v, &r->x);
+    field_wide_mul(&y3, &rr, &v);
+    field_add(&j, &j, &j);
+    field_wide_mul(&y1j, &p->y, &j);
+    field_wide_sub(&y3, &y3, &y1j);
+    field_wide_reduce(&r->y, &y3);
+}
+
+/*
+ * Scalar multiplication for secret scalars: Montgomery ladder over all 256
+ * bits with branch-free swaps.
+ */
+void point_mul(point_t *r, const point_t *p, const scalar_t *k) {
+    scalar_t scalar;
     point_t r0, r1;
 
+    fr_from_mont(&scalar, k);
     point_set_infinity(&r0);
     r1 = *p;
 
     for (int i = 255; i >= 0; i--) {
         int limb = i / 64;
         int bit = i % 64;
-        uint64_t b = (scalar->limbs[limb] >> bit) & 1;
+        uint64_t b = (scalar.limbs[limb] >> bit) & 1;
 
         uint64_t mask = -(uint64_t)b;
 
@@ -327,6 +379,435 @@ static void __attribute__((unused)) point_mul(point_t *r, const point_t *p, cons
     *r = r0;
 }
 
+void point_to_affine(point_t *r, const point_t *p) {
+    if (point_is_infinity(p)) {
+        point_set_infinity(r);
+        return;
+    }
+
+    field_t zinv, zinv2;
+    field_inv(&zinv, &p->z);
+    field_sqr(&zinv2, &zinv);
+    field_mul(&r->x, &p->x, &zinv2);
+    field_mul(&zinv2, &zinv2, &zinv);
+    field_mul(&r->y, &p->y, &zinv2);
+    field_set_one(&r->z);
+}
+
+void point_to_affine_vartime(point_t *r, const point_t *p) {
+    if (point_is_infinity(p)) {
+        point_set_infinity(r);
+        return;
+    }
+
+    field_t zinv, zinv2;
+    field_inv_vartime(&zinv, &p->z);
+    field_sqr(&zinv2, &zinv);
+    field_mul(&r->x, &p->x, &zinv2);
+    field_mul(&zinv2, &zinv2, &zinv);
+    field_mul(&r->y, &p->y, &zinv2);
+    field_set_one(&r->z);
+}
+
+void point_batch_to_affine(point_t *r, const point_t *p, size_t n) {
+    arena_t *scratch = scratch_arena_get();
+    arena_checkpoint_t cp = arena_checkpoint(scratch);
+    field_t *zinv = arena_alloc(scratch, n * sizeof(field_t));
+
+    if (!zinv) {
+        arena_restore(scratch, cp);
+        for (size_t i = 0; i < n; i++) {
+            point_to_affine_vartime(&r[i], &p[i]);
+        }
+        return;
+    }
+
+    /* Infinity stands in with Z = 1 so the shared inversion stays nonzero */
+    for (size_t i = 0; i < n; i++) {
+        if (point_is_infinity(&p[i])) {
+            field_set_one(&zinv[i]);
+        } else {
+            field_copy(&zinv[i], &p[i].z);
+        }
+    }
+    field_batch_inv(zinv, zinv, n);
+
+    field_t zinv2;
+    for (size_t i = 0; i < n; i++) {
+        if (point_is_infinity(&p[i])) {
+            point_set_infinity(&r[i]);
+            continue;
+        }
+        field_sqr(&zinv2, &zinv[i]);
+        field_mul(&r[i].x, &p[i].x, &zinv2);
+        field_mul(&zinv2, &zinv2, &zinv[i]);
+        field_mul(&r[i].y, &p[i].y, &zinv2);
+        field_set_one(&r[i].z);
+    }
+
+    arena_restore(scratch, cp);
+}
+
+/* c-bit window of a canonical scalar starting at bit `pos` */
+static uint64_t scalar_window(const scalar_t *k, unsigned pos, unsigned c) {
+    unsigned limb = pos / 64, shift = pos % 64;
+    uint64_t w = k->limbs[limb] >> shift;
+    if (shift + c > 64 && limb < 3) {
+        w |= k->limbs[limb + 1] << (64 - shift);
+    }
+    return w & ((1ULL << c) - 1);
+}
+
+/*
+ * Width-5 NAF of a canonical scalar: odd digits in [-15, 15], nonzero
+ * digits at least five positions apart. Returns one past the top digit.
+ */
+#define WNAF_WIDTH 5
+#define WNAF_TABLE (1 << (WNAF_WIDTH - 2))     /* P, 3P, ..., 15P */
+
+static int scalar_wnaf(int8_t naf[256], const scalar_t *k) {
+    int carry = 0, len = 0;
+
+    memset(naf, 0, 256);
+    for (unsigned bit = 0; bit < 256; ) {
+        if ((int)((k->limbs[bit / 64] >> (bit % 64)) & 1) == carry) {
+            bit++;
+            continue;
+        }
+        unsigned now = 256 - bit < WNAF_WIDTH ? 256 - bit : WNAF_WIDTH;
+        int word = (int)scalar_window(k, bit, now) + carry;
+        carry = (word >> (WNAF_WIDTH - 1)) & 1;
+        word -= carry << WNAF_WIDTH;
+        naf[bit] = (int8_t)word;
+        len = (int)bit + 1;
+        bit += now;
+    }
+    return len;
+}
+
+/*
+ * GLV endomorphism: φ(x, y) = (β·x, y) equals λ·P on G1, with β a cube
+ * root of unity in Fp and λ one in Fr. A scalar splits as k = k1 + k2·λ
+ * with |k1|, |k2| < 2^128 using the short lattice basis
+ *   v1 = (a1, b1) = (0x89d3256894d213e3, -0x6f4d8248eeb859fc8211bbeb7d4f1128)
+ *   v2 = (a2, b2) = (0x6f4d8248eeb859fd0be4e1541221250b, 0x89d3256894d213e3)
+ * via c1 = round(b2·k/r), c2 = round(-b1·k/r), k2 = -c1·b1 - c2·b2 and
+ * k1 = k - k2·λ. The roundings use g = round(2^256·b/r).
+ */
+static const field_t GLV_BETA = {{
+    0x71930C11D782E155ULL, 0xA6BB947CFFBE3323ULL,
+    0xAA303344D4741444ULL, 0x2C3B3F0D26594943ULL
+}};
+
+/* λ, -b1 and -b2 in Fr, Montgomery form */
+static const scalar_t GLV_LAMBDA = {{
+    0x93E7CEDE4A0329B3ULL, 0x7D4FDCA77A96C167ULL,
+    0x8BE4BA08B19A750AULL, 0x1CBD5653A5661C25ULL
+}};
+static const scalar_t GLV_MINUS_B1 = {{
+    0x6F7E7AC096E14E73ULL, 0x2F18111C3EB36423ULL,
+    0x211EB72D4914EABBULL, 0x1F5BAA27FA2767C8ULL
+}};
+static const scalar_t GLV_MINUS_B2 = {{
+    0x1F7CC8D147E0B3D8ULL, 0x71B98E53F86C230DULL,
+    0xC13246FC769BB9EBULL, 0x1B76169EFC0E7649ULL
+}};
+
+static const uint64_t GLV_G1[3] = {0xD91D232EC7E0B3D7ULL, 0x2ULL, 0};
+static const uint64_t GLV_G2[3] = {0x7A7BD9D4391EB18EULL, 0x4CCEF014A773D2CFULL, 0x2ULL};
+
+/* round(k·g / 2^256), known to fit in 128 bits */
+static void glv_round(uint64_t c[2], const uint64_t k[4], const uint64_t g[3]) {
+    uint64_t t[7] = {0};
+    for (int i = 0; i < 4; i++) {
+        __uint128_t acc = 0;
+        for (int j = 0; j < 3; j++) {
+            acc += (__uint128_t)k[i] * g[j] + t[i + j];
+            t[i + j] = (uint64_t)acc;
+            acc >>= 64;
+        }
+        t[i + 3] = (uint64_t)acc;
+    }
+    /* + 2^255 rounds to nearest */
+    __uint128_t acc = (__uint128_t)t[3] + (1ULL << 63);
+    acc = (acc >> 64) + t[4];
+    c[0] = (uint64_t)acc;
+    c[1] = (uint64_t)((acc >> 64) + t[5]);
+}
+
+/*
+ * Canonical k -> canonical |k1|, |k2| < 2^128 and their signs, with
+ * k = ±k1 ± k2·λ mod r.
+ */
+static void scalar_glv_split(scalar_t *k1, bool *neg1, scalar_t *k2, bool *neg2,
+                             const scalar_t *k) {
+    uint64_t c[2];
+    scalar_t c1, c2, km;
+
+    glv_round(c, k->limbs, GLV_G1);
+    c1 = (scalar_t){{c[0], c[1], 0, 0}};
+    glv_round(c, k->limbs, GLV_G2);
+    c2 = (scalar_t){{c[0], c[1], 0, 0}};
+    fr_to_mont(&c1, &c1);
+    fr_to_mont(&c2, &c2);
+    fr_to_mont(&km, k);
+
+    fr_mul(&c1, &c1, &GLV_MINUS_B1);
+    fr_mul(&c2, &c2, &GLV_MINUS_B2);
+    fr_add(k2, &c1, &c2);
+    fr_mul(&c1, k2, &GLV_LAMBDA);
+    fr_sub(k1, &km, &c1);
+    fr_from_mont(k1, k1);
+    fr_from_mont(k2, k2);
+
+    /* Either half is below 2^128 or above r - 2^128 */
+    *neg1 = (k1->limbs[2] | k1->limbs[3]) != 0;
+    *neg2 = (k2->limbs[2] | k2->limbs[3]) != 0;
+    if (*neg1) fr_neg(k1, k1);
+    if (*neg2) fr_neg(k2, k2);
+}
+
+/* Canonical scalar below 2^128: no split needed */
+static bool scalar_is_short(const scalar_t *k) {
+    return (k->limbs[2] | k->limbs[3]) == 0;
+}
+
+static void point_endo(point_t *r, const point_t *p) {
+    field_mul(&r->x, &p->x, &GLV_BETA);
+    r->y = p->y;
+    r->z = p->z;
+}
+
+static void point_neg(point_t *r, const point_t *p) {
+    *r = *p;
+    field_neg(&r->y, &r->y);
+}
+
+/*
+ * Scalar multiplication for public scalars, wNAF over 128-bit halves:
+ * scalars below 2^128 (batch randomizers) run directly, full-width ones
+ * are GLV-split and the two wNAFs share one chain of about 128 doublings.
+ * Timing depends on the scalar.
+ */
+void point_mul_vartime(point_t *r, const point_t *p, const scalar_t *k) {
+    scalar_t canon, half[2];
+    bool neg[2] = {false, false};
+    point_t table[2][WNAF_TABLE], p2, acc, t;
+    int8_t naf[2][256];
+    int terms = 1, len = 0;
+
+    fr_from_mont(&canon, k);
+    if (scalar_is_short(&canon)) {
+        half[0] = canon;
+    } else {
+        scalar_glv_split(&half[0], &neg[0], &half[1], &neg[1], &canon);
+        terms = 2;
+    }
+
+    table[0][0] = *p;
+    point_double(&p2, p);
+    for (int i = 1; i < WNAF_TABLE; i++) {
+        point_add(&table[0][i], &table[0][i - 1], &p2);
+    }
+    if (terms == 2) {
+        for (int i = 0; i < WNAF_TABLE; i++) point_endo(&table[1][i], &table[0][i]);
+    }
+
+    for (int j = 0; j < terms; j++) {
+        int n = scalar_wnaf(naf[j], &half[j]);
+        if (n > len) len = n;
+    }
+
+    point_set_infinity(&acc);
+    for (int i = len; i-- > 0; ) {
+        point_double(&acc, &acc);
+        for (int j = 0; j < terms; j++) {
+            int d = naf[j][i];
+            if (d == 0) continue;
+            if ((d < 0) != neg[j]) {
+                point_neg(&t, &table[j][(d < 0 ? -d : d) >> 1]);
+                point_add(&acc, &acc, &t);
+            } else {
+                point_add(&acc, &acc, &table[j][(d < 0 ? -d : d) >> 1]);
+            }
+        }
+    }
+    *r = acc;
+}
+
+static unsigned msm_window_bits(size_t n) {
+    if (n < 32) return 3;
+    unsigned log2n = 0;
+    while ((n >> log2n) > 1) log2n++;
+    /* ~log2(n) - 2 balances bucket accumulation against n additions per window */
+    unsigned c = log2n - 2;
+    return c > 16 ? 16 : c;
+}
+
+typedef struct {
+    const point_t *points;      /* Affine (Z = 1) or infinity */
+    const scalar_t *k;          /* Canonical scalars */
+    size_t n;
+    unsigned c;
+    point_t *window_sums;
+    _Atomic(bool) failed;
+} msm_job_t;
+
+/* Σ d·bucket[d] for windows [begin, end), buckets from this thread's scratch */
+static void msm_windows(void *arg, size_t begin, size_t end) {
+    msm_job_t *job = arg;
+    size_t num_buckets = ((size_t)1 << job->c) - 1;
+
+    arena_t *scratch = scratch_arena_get();
+    arena_checkpoint_t cp = arena_checkpoint(scratch);
+    point_t *buckets = arena_alloc(scratch, num_buckets * sizeof(point_t));
+    if (!buckets) {
+        atomic_store(&job->failed, true);
+        arena_restore(scratch, cp);
+        return;
+    }
+
+    for (size_t w = begin; w < end; w++) {
+        for (size_t b = 0; b < num_buckets; b++) {
+            point_set_infinity(&buckets[b]);
+        }
+
+        for (size_t i = 0; i < job->n; i++) {
+            uint64_t digit = scalar_window(&job->k[i], (unsigned)w * job->c, job->c);
+            if (digit) {
+                point_add_affine(&buckets[digit - 1], &buckets[digit - 1], &job->points[i]);
+            }
+        }
+
+        point_t running, sum;
+        point_set_infinity(&running);
+        point_set_infinity(&sum);
+        for (size_t b = num_buckets; b-- > 0; ) {
+            point_add(&running, &running, &buckets[b]);
+            point_add(&sum, &sum, &running);
+        }
+        job->window_sums[w] = sum;
+    }
+
+    arena_restore(scratch, cp);
+}
+
+/* Below this many terms, one wNAF multiplication per term is cheaper */
+#define MSM_PIPPENGER_MIN 5
+
+static void msm_naive(point_t *r, const point_t *points, const scalar_t *scalars, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        point_t t;
+        point_mul_vartime(&t, &points[i], &scalars[i]);
+        point_add(r, r, &t);
+    }
+}
+
+/*
+ * Pippenger bucket method.
+ *
+ * Each c-bit window drops every point into the bucket of its digit, then
+ * Σ d·bucket[d] is formed with a running suffix sum. Windows are
+ * independent, so they are spread over the pool; the window sums are then
+ * combined top-down with c doublings between them. Full-width scalars are
+ * GLV-split first (2n terms of 128 bits), and only as many windows run as
+ * the widest scalar needs, so 128-bit batch randomizers pay for half the
+ * windows and doublings. Inputs that are not already affine are
+ * normalized with one shared inversion, so every bucket add is a mixed
+ * addition. Variable-time in the scalars.
+ */
+static bool msm_pippenger(point_t *r, const point_t *points, const scalar_t *scalars,
+                          size_t n, threadpool_t *pool, arena_t *scratch) {
+    field_t one;
+    field_set_one(&one);
+    for (size_t i = 0; i < n; i++) {
+        if (!point_is_infinity(&points[i]) && !field_eq_vartime(&points[i].z, &one)) {
+            point_t *affine = arena_alloc(scratch, n * sizeof(point_t));
+            if (!affine) return false;
+            point_batch_to_affine(affine, points, n);
+            points = affine;
+            break;
+        }
+    }
+
+    /* Canonical scalars, with room for the GLV halves */
+    scalar_t *k = arena_alloc(scratch, 2 * n * sizeof(scalar_t));
+    if (!k) return false;
+
+    bool all_short = true;
+    for (size_t i = 0; i < n; i++) {
+        fr_from_mont(&k[i], &scalars[i]);
+        all_short &= scalar_is_short(&k[i]);
+    }
+
+    const point_t *msm_points = points;
+    size_t m = n;
+    if (!all_short) {
+        point_t *split = arena_alloc(scratch, 2 * n * sizeof(point_t));
+        if (!split) return false;
+
+        /* Descending, so k[i] is read before k[2i], k[2i+1] overwrite it */
+        for (size_t i = n; i-- > 0; ) {
+            scalar_t ki = k[i];
+            bool neg1, neg2;
+            scalar_glv_split(&k[2 * i], &neg1, &k[2 * i + 1], &neg2, &ki);
+            split[2 * i] = points[i];
+            if (neg1) field_neg(&split[2 * i].y, &split[2 * i].y);
+            point_endo(&split[2 * i + 1], &points[i]);
+            if (neg2) field_neg(&split[2 * i + 1].y, &split[2 * i + 1].y);
+        }
+        msm_points = split;
+        m = 2 * n;
+    }
+
+    /* Every scalar is now below 2^128; run only the windows in use */
+    uint64_t hi = 0, lo = 0;
+    for (size_t i = 0; i < m; i++) {
+        hi |= k[i].limbs[1];
+        lo |= k[i].limbs[0];
+    }
+    unsigned bits = hi ? 128 - (unsigned)__builtin_clzll(hi)
+                  : lo ? 64 - (unsigned)__builtin_clzll(lo) : 0;
+    if (bits == 0) return true;
+
+    unsigned c = msm_window_bits(m);
+    size_t num_windows = (bits + c - 1) / c;
+    point_t *window_sums = arena_alloc(scratch, num_windows * sizeof(point_t));
+    if (!window_sums) return false;
+
+    msm_job_t job = {
+        .points = msm_points, .k = k, .n = m, .c = c, .window_sums = window_sums,
+    };
+    atomic_store(&job.failed, false);
+    threadpool_for(pool, num_windows, 1, msm_windows, &job);
+    if (atomic_load(&job.failed)) return false;
+
+    for (size_t w = num_windows; w-- > 0; ) {
+        for (unsigned d = 0; d < c; d++) {
+            point_double(r, r);
+        }
+        point_add(r, r, &window_sums[w]);
+    }
+    return true;
+}
+
+void point_msm(point_t *r, const point_t *points, const scalar_t *scalars, size_t n,
+               threadpool_t *pool) {
+    point_set_infinity(r);
+    if (n == 0) return;
+
+    if (n >= MSM_PIPPENGER_MIN) {
+        arena_t *scratch = scratch_arena_get();
+        arena_checkpoint_t cp = arena_checkpoint(scratch);
+        bool ok = msm_pippenger(r, points, scalars, n, pool, scratch);
+        arena_restore(scratch, cp);
+        if (ok) return;
+    }
+
+    /* Few terms, or out of scratch: independent multiplications */
+    msm_naive(r, points, scalars, n);
+}
+
 verify_ctx_t *verify_ctx_create(arena_t *arena) {
     verify_ctx_t *ctx = arena_alloc(arena, sizeof(verify_ctx_t));
     if (!ctx) return NULL;
@@ -415,6 +896,29 @@ bool verify_ctx_load_vk(verify_ctx_t *ctx, const uint8_t *vk_data, size_t len) {
     return true;
 }
 
+/* 64 bytes x || y; all-zero encodes infinity */
+static void parse_g1(g1_t *p, const uint8_t *data) {
+    field_from_bytes(&p->x, data);
+    field_from_bytes(&p->y, data + 32);
+    field_to_mont(&p->x, &p->x);
+    field_to_mont(&p->y, &p->y);
+    p->is_infinity = field_is_zero(&p->x) && field_is_zero(&p->y);
+}
+
+/* 128 bytes x_re || x_im || y_re || y_im; all-zero encodes infinity */
+static void parse_g2(g2_t *p, const uint8_t *data) {
+    field_from_bytes(&p->x_re, data);
+    field_from_bytes(&p->x_im, data + 32);
+    field_from_bytes(&p->y_re, data + 64);
+    field_from_bytes(&p->y_im, data + 96);
+    field_to_mont(&p->x_re, &p->x_re);
+    field_to_mont(&p->x_im, &p->x_im);
+    field_to_mont(&p->y_re, &p->y_re);
+    field_to_mont(&p->y_im, &p->y_im);
+    p->is_infinity = field_is_zero(&p->x_re) && field_is_zero(&p->x_im) &&
+                     field_is_zero(&p->y_re) && field_is_zero(&p->y_im);
+}
+
 /*
  * Parse wire format proof into expanded proof structure.
  *
@@ -436,50 +940,11 @@ bool proof_parse(proof_t *out, const proof_wire_t *wire) {
     field_from_bytes(&out->commitment, wire->commitment);
     field_to_mont(&out->commitment, &out->commitment);
 
+    /* Points are only decoded here; validation is one later stage */
     const uint8_t *data = wire->proof_data;
-
-    /* Parse A point (G1) from bytes 0-63 */
-    field_from_bytes(&out->proof_point_a.x, data);
-    field_from_bytes(&out->proof_point_a.y, data + 32);
-    field_set_one(&out->proof_point_a.z);
-    field_to_mont(&out->proof_point_a.x, &out->proof_point_a.x);
-    field_to_mont(&out->proof_point_a.y, &out->proof_point_a.y);
-
-    /* Parse B point (G2) from bytes 64-191: x_re, x_im, y_re, y_im */
-    field_from_bytes(&out->proof_point_b.x_re, data + 64);
-    field_from_bytes(&out->proof_point_b.x_im, data + 96);
-    field_from_bytes(&out->proof_point_b.y_re, data + 128);
-    field_from_bytes(&out->proof_point_b.y_im, data + 160);
-    field_to_mont(&out->proof_point_b.x_re, &out->proof_point_b.x_re);
-    field_to_mont(&out->proof_point_b.x_im, &out->proof_point_b.x_im);
-    field_to_mont(&out->proof_point_b.y_re, &out->proof_point_b.y_re);
-    field_to_mont(&out->proof_point_b.y_im, &out->proof_point_b.y_im);
-
-    /* Check if B is point at infinity (all coords zero) */
-    out->proof_point_b.is_infinity =
-        field_is_zero(&out->proof_point_b.x_re) &&
-        field_is_zero(&out->proof_point_b.x_im) &&
-        field_is_zero(&out->proof_point_b.y_re) &&
-        field_is_zero(&out->proof_point_b.y_im);
-
-    /* Parse C point (G1) from bytes 192-255 */
-    field_from_bytes(&out->proof_point_c.x, data + 192);
-    field_from_bytes(&out->proof_point_c.y, data + 224);
-    field_set_one(&out->proof_point_c.z);
-    field_to_mont(&out->proof_point_c.x, &out->proof_point_c.x);
-    field_to_mont(&out->proof_point_c.y, &out->proof_point_c.y);
-
-    /* Validate G1 proof points on curve */
-    if (!point_is_infinity(&out->proof_point_a) && !point_is_on_curve(&out->proof_point_a)) {
-        LOG_DEBUG("proof_parse: A point not on curve");
-        return false;
-    }
-    if (!point_is_infinity(&out->proof_point_c) && !point_is_on_curve(&out->proof_point_c)) {
-        LOG_DEBUG("proof_parse: C point not on curve");
-        return false;
-    }
-
-    /* G2 curve validation done in pairing layer via g2_is_on_curve */
+    parse_g1(&out->points.a, data);
+    parse_g2(&out->points.b, data + 64);
+    parse_g1(&out->points.c, data + 192);
     return true;
 }
 
@@ -498,13 +963,15 @@ verify_result_t verify_proof(verify_ctx_t *ctx, const proof_wire_t *wire) {
     return result;
 }
 
-verify_result_t verify_proof_ex(verify_ctx_t *ctx, const proof_t *proof) {
-    LOG_TRACE("verify_proof_ex: threshold=%u timestamp=%u",
-              proof->threshold, proof->timestamp);
-
+/*
+ * Checks that need no pairing: age, threshold, and A and C not at
+ * infinity (an all-zero G1 encoding). Shared by the single and batch
+ * paths so both reject the same proofs with the same code.
+ */
+static verify_result_t proof_precheck(const verify_ctx_t *ctx, const proof_t *proof) {
     if (ctx->current_time > 0) {
         if (proof->timestamp + ctx->max_proof_age < ctx->current_time) {
-            LOG_DEBUG("verify_proof_ex: expired (age=%lu max=%u)",
+            LOG_DEBUG("proof_precheck: expired (age=%lu max=%u)",
                       ctx->current_time - proof->timestamp, ctx->max_proof_age);
             return VERIFY_EXPIRED;
         }
@@ -514,6 +981,22 @@ verify_result_t verify_proof_ex(verify_ctx_t *ctx, const proof_t *proof) {
         return VERIFY_BELOW_THRESHOLD;
     }
 
+    if (proof->points.a.is_infinity || proof->points.c.is_infinity) {
+        return VERIFY_INVALID_PROOF;
+    }
+
+    return VERIFY_OK;
+}
+
+verify_result_t verify_proof_ex(verify_ctx_t *ctx, const proof_t *proof) {
+    LOG_TRACE("verify_proof_ex: threshold=%u timestamp=%u",
+              proof->threshold, proof->timestamp);
+
+    verify_result_t pre = proof_precheck(ctx, proof);
+    if (pre != VERIFY_OK) {
+        return pre;
+    }
+
     field_t inputs[3];
     field_copy(&inputs[0], &proof->agent_pk);
     field_copy(&inputs[1], &proof->commitment);
@@ -524,21 +1007,6 @@ verify_result_t verify_proof_ex(verify_ctx_t *ctx, const proof_t *proof) {
     field_t pub_input;
     poseidon_hash(&pub_input, inputs, 3);
 
-    /* Validate proof points are on curve (prevent invalid curve attacks) */
-    if (point_is_infinity(&proof->proof_point_a)) {
-        return VERIFY_INVALID_PROOF;
-    }
-    if (!point_is_on_curve(&proof->proof_point_a)) {
-        return VERIFY_INVALID_PROOF;
-    }
-
-    if (point_is_infinity(&proof->proof_point_c)) {
-        return VERIFY_INVALID_PROOF;
-    }
-    if (!point_is_on_curve(&proof->proof_point_c)) {
-        return VERIFY_INVALID_PROOF;
-    }
-
     /*
      * Groth16 pairing verification:
      * e(A, B) = e(α, β) · e(pub_input·IC, γ) · e(C, δ)
@@ -546,34 +1014,13 @@ verify_result_t verify_proof_ex(verify_ctx_t *ctx, const proof_t *proof) {
      * Uses mcl library for BN254 optimal ate pairing when available.
      */
     if (pairing_is_initialized() && ctx->groth16_vk) {
-        /* Convert proof points to pairing format */
-        groth16_proof_t g16_proof;
-
-        /* Copy A (G1 point) */
-        g16_proof.a.is_infinity = point_is_infinity(&proof->proof_point_a);
-        if (!g16_proof.a.is_infinity) {
-            field_copy(&g16_proof.a.x, &proof->proof_point_a.x);
-            field_copy(&g16_proof.a.y, &proof->proof_point_a.y);
-        }
-
-        /* Copy B (G2 point) with full Fp2 coordinates */
-        g16_proof.b.is_infinity = proof->proof_point_b.is_infinity;
-        if (!g16_proof.b.is_infinity) {
-            field_copy(&g16_proof.b.x_re, &proof->proof_point_b.x_re);
-            field_copy(&g16_proof.b.x_im, &proof->proof_point_b.x_im);
-            field_copy(&g16_proof.b.y_re, &proof->proof_point_b.y_re);
-            field_copy(&g16_proof.b.y_im, &proof->proof_point_b.y_im);
+        /* The one validation pass: curve and subgroup checks (invalid curve attacks) */
+        groth16_valid_proof_t valid;
+        if (!groth16_proof_validate(&valid, &proof->points)) {
+            return VERIFY_MALFORMED;
         }
 
-        /* Copy C (G1 point) */
-        g16_proof.c.is_infinity = point_is_infinity(&proof->proof_point_c);
-        if (!g16_proof.c.is_infinity) {
-            field_copy(&g16_proof.c.x, &proof->proof_point_c.x);
-            field_copy(&g16_proof.c.y, &proof->proof_point_c.y);
-        }
-
-        /* Verify using pairing */
-        if (!groth16_verify(ctx->groth16_vk, &g16_proof, &pub_input, 1)) {
+        if (!groth16_verify_validated(ctx->groth16_vk, &valid, &pub_input, 1)) {
             return VERIFY_INVALID_PROOF;
         }
     } else {
@@ -608,11 +1055,10 @@ batch_ctx_t *batch_create(verify_ctx_t *ctx, size_t capacity) {
     batch->ctx = ctx;
     batch->proofs = arena_alloc(ctx->arena, capacity * sizeof(proof_t));
     batch->results = arena_alloc(ctx->arena, capacity * sizeof(verify_result_t));
-    batch->randoms = arena_alloc(ctx->arena, capacity * sizeof(field_t));
     batch->count = 0;
     batch->capacity = capacity;
 
-    if (!batch->proofs || !batch->results || !batch->randoms) {
+    if (!batch->proofs || !batch->results) {
         LOG_ERROR("batch_create: arena alloc failed for arrays (capacity=%zu)", capacity);
         return NULL;
     }
@@ -640,26 +1086,98 @@ bool batch_add(batch_ctx_t *batch, const proof_wire_t *wire) {
         return true;  /* Proof added (but marked malformed) */
     }
 
-    uint8_t rand_bytes[32];
-    if (!get_random_bytes(rand_bytes, 32)) {
-        /* RNG failure is fatal - never use predictable randomness */
-        LOG_ERROR("batch_add: RNG failed - cannot generate random coefficient");
-        batch->results[batch->count] = VERIFY_MALFORMED;
-        batch->count++;
-        return false;  /* RNG failure is a system error */
-    }
-    /* Reduce to 128 bits for batch coefficient (sufficient security) */
-    rand_bytes[16] = rand_bytes[17] = rand_bytes[18] = rand_bytes[19] = 0;
-    rand_bytes[20] = rand_bytes[21] = rand_bytes[22] = rand_bytes[23] = 0;
-    rand_bytes[24] = rand_bytes[25] = rand_bytes[26] = rand_bytes[27] = 0;
-    rand_bytes[28] = rand_bytes[29] = rand_bytes[30] = rand_bytes[31] = 0;
-    field_from_bytes(&batch->randoms[batch->count], rand_bytes);
-    field_to_mont(&batch->randoms[batch->count], &batch->randoms[batch->count]);
-
+    /* Batch coefficients are drawn or derived in batch_verify */
     batch->count++;
     return true;
 }
 
+/* Proofs per prep chunk: whole IFMA lane groups */
+#define BATCH_PREP_GRAIN 32
+
+typedef struct {
+    const proof_t *proofs;
+    const size_t *valid_indices;
+    groth16_proof_t *g16_proofs;
+    field_t *inputs_storage;
+} batch_prep_t;
+
+static void batch_prep_range(void *arg, size_t begin, size_t end) {
+    batch_prep_t *prep = arg;
+
+    /* Public input hashes through the multi-lane kernel, a grain at a time */
+    for (size_t lo = begin; lo < end; lo += BATCH_PREP_GRAIN) {
+        size_t n = end - lo < BATCH_PREP_GRAIN ? end - lo : BATCH_PREP_GRAIN;
+        field_t inputs[BATCH_PREP_GRAIN * 3];
+        for (size_t j = 0; j < n; j++) {
+            const proof_t *proof = &prep->proofs[prep->valid_indices[lo + j]];
+            field_t *in = &inputs[j * 3];
+            field_copy(&in[0], &proof->agent_pk);
+            field_copy(&in[1], &proof->commitment);
+            in[2].limbs[0] = proof->threshold;
+            in[2].limbs[1] = in[2].limbs[2] = in[2].limbs[3] = 0;
+            field_to_mont(&in[2], &in[2]);
+        }
+        poseidon_hash_many(&prep->inputs_storage[lo], inputs, 3, n);
+    }
+
+    for (size_t j = begin; j < end; j++) {
+        prep->g16_proofs[j] = prep->proofs[prep->valid_indices[j]].points;
+    }
+}
+
+/*
+ * Fault isolation for a failed batch.
+ *
+ * Splits [lo, hi) in half and re-runs the batch check on each half,
+ * recursing only into halves that fail, so k bad proofs cost O(k·log n)
+ * sub-batch checks instead of n single verifications. Parsed points and
+ * Poseidon hashes from the original batch are reused as-is. `known_bad`
+ * means [lo, hi) is already known to fail: when the left half passes, the
+ * right half must fail and is not re-checked. Sub-batches reuse the slice
+ * of `coeffs` (NULL = fresh random coefficients per check).
+ */
+typedef struct {
+    verify_ctx_t *ctx;
+    const groth16_valid_proof_t *proofs;
+    const field_t **pub_inputs;
+    const size_t *num_inputs;
+    const size_t *valid_indices;
+    const scalar_t *coeffs;
+    verify_result_t *results;
+} batch_bisect_t;
+
+static void batch_bisect(const batch_bisect_t *b, size_t lo, size_t hi, bool known_bad) {
+    size_t n = hi - lo;
+
+    if (n == 1) {
+        bool ok = !known_bad &&
+                  groth16_verify_validated(b->ctx->groth16_vk, &b->proofs[lo],
+                                           b->pub_inputs[lo], b->num_inputs[lo]);
+        if (!ok) {
+            b->results[b->valid_indices[lo]] = VERIFY_INVALID_PROOF;
+        }
+        return;
+    }
+
+    const scalar_t *coeffs = b->coeffs ? &b->coeffs[lo] : NULL;
+    if (!known_bad &&
+        groth16_verify_batch_validated(b->ctx->groth16_vk, &b->proofs[lo],
+                                       &b->pub_inputs[lo], &b->num_inputs[lo], n,
+                                       coeffs, b->ctx->pool)) {
+        return;
+    }
+
+    size_t mid = lo + n / 2;
+    bool left_ok = groth16_verify_batch_validated(b->ctx->groth16_vk, &b->proofs[lo],
+                                                  &b->pub_inputs[lo], &b->num_inputs[lo],
+                                                  mid - lo, coeffs, b->ctx->pool);
+    if (!left_ok) {
+        batch_bisect(b, lo, mid, true);
+    }
+    /* [lo, hi) fails, so a passing left half pins the failure on the right */
+    batch_bisect(b, mid, hi, left_ok);
+}
+
 bool batch_verify(batch_ctx_t *batch) {
     if (batch->count == 0) {
         LOG_DEBUG("batch_verify: empty batch");
@@ -668,22 +1186,9 @@ bool batch_verify(batch_ctx_t *batch) {
 
     LOG_DEBUG("batch_verify: verifying %zu proofs", batch->count);
 
-    /* Pre-filter: check timestamps and thresholds */
+    /* Pre-filter: the same age, threshold and infinity checks as one proof */
     for (size_t i = 0; i < batch->count; i++) {
-        batch->results[i] = VERIFY_OK;
-
-        if (batch->ctx->current_time > 0) {
-            if (batch->proofs[i].timestamp + batch->ctx->max_proof_age <
-                batch->ctx->current_time) {
-                batch->results[i] = VERIFY_EXPIRED;
-                continue;
-            }
-        }
-
-        if (batch->proofs[i].threshold < batch->ctx->min_threshold) {
-            batch->results[i] = VERIFY_BELOW_THRESHOLD;
-            continue;
-        }
+        batch->results[i] = proof_precheck(batch->ctx, &batch->proofs[i]);
     }
 
     /* Count valid proofs needing cryptographic verification */
@@ -715,14 +1220,18 @@ bool batch_verify(batch_ctx_t *batch) {
     arena_t *scratch = scratch_arena_get();
     arena_checkpoint_t cp = arena_checkpoint(scratch);
 
-    /* Build arrays for groth16_verify_batch */
+    /* Build arrays for groth16_verify_batch_validated */
     groth16_proof_t *g16_proofs = arena_alloc(scratch, valid_count * sizeof(groth16_proof_t));
+    groth16_valid_proof_t *valid_proofs =
+        arena_alloc(scratch, valid_count * sizeof(groth16_valid_proof_t));
+    bool *valid_flags = arena_alloc(scratch, valid_count * sizeof(bool));
     field_t **pub_inputs = arena_alloc(scratch, valid_count * sizeof(field_t *));
     size_t *num_inputs = arena_alloc(scratch, valid_count * sizeof(size_t));
     field_t *inputs_storage = arena_alloc(scratch, valid_count * sizeof(field_t));
     size_t *valid_indices = arena_alloc(scratch, valid_count * sizeof(size_t));
 
-    if (!g16_proofs || !pub_inputs || !num_inputs || !inputs_storage || !valid_indices) {
+    if (!g16_proofs || !valid_proofs || !valid_flags || !pub_inputs || !num_inputs ||
+        !inputs_storage || !valid_indices) {
         LOG_WARN("batch_verify: arena alloc failed, falling back to sequential");
         arena_restore(scratch, cp);
         for (size_t i = 0; i < batch->count; i++) {
@@ -735,68 +1244,101 @@ bool batch_verify(batch_ctx_t *batch) {
 
     size_t j = 0;
     for (size_t i = 0; i < batch->count; i++) {
-        if (batch->results[i] != VERIFY_OK) continue;
-
-        proof_t *proof = &batch->proofs[i];
-        valid_indices[j] = i;
+        if (batch->results[i] == VERIFY_OK) {
+            valid_indices[j++] = i;
+        }
+    }
 
-        /* Compute public input hash */
-        field_t inputs[3];
-        field_copy(&inputs[0], &proof->agent_pk);
-        field_copy(&inputs[1], &proof->commitment);
-        inputs[2].limbs[0] = proof->threshold;
-        inputs[2].limbs[1] = inputs[2].limbs[2] = inputs[2].limbs[3] = 0;
-        field_to_mont(&inputs[2], &inputs[2]);
+    /* Public-input hashing and point copies, spread over the pool */
+    batch_prep_t prep = {
+        .proofs = batch->proofs,
+        .valid_indices = valid_indices,
+        .g16_proofs = g16_proofs,
+        .inputs_storage = inputs_storage,
+    };
+    threadpool_for(batch->ctx->pool, valid_count, BATCH_PREP_GRAIN, batch_prep_range, &prep);
 
-        poseidon_hash(&inputs_storage[j], inputs, 3);
+    for (j = 0; j < valid_count; j++) {
         pub_inputs[j] = &inputs_storage[j];
         num_inputs[j] = 1;
+    }
 
-        /* Convert proof to groth16 format */
-        g16_proofs[j].a.is_infinity = point_is_infinity(&proof->proof_point_a);
-        if (!g16_proofs[j].a.is_infinity) {
-            field_copy(&g16_proofs[j].a.x, &proof->proof_point_a.x);
-            field_copy(&g16_proofs[j].a.y, &proof->proof_point_a.y);
-        }
-
-        g16_proofs[j].b.is_infinity = proof->proof_point_b.is_infinity;
-        if (!g16_proofs[j].b.is_infinity) {
-            field_copy(&g16_proofs[j].b.x_re, &proof->proof_point_b.x_re);
-            field_copy(&g16_proofs[j].b.x_im, &proof->proof_point_b.x_im);
-            field_copy(&g16_proofs[j].b.y_re, &proof->proof_point_b.y_re);
-            field_copy(&g16_proofs[j].b.y_im, &proof->proof_point_b.y_im);
+    /*
+     * Deterministic mode: coefficients and the subgroup-check scalars both
+     * come from the batch transcript, so nothing below touches the RNG
+     */
+    scalar_t *coeffs = NULL;
+    uint8_t seed_storage[GROTH16_BATCH_SEED_SIZE];
+    const uint8_t *seed = NULL;
+    if (batch->ctx->batch_coeffs == BATCH_COEFFS_TRANSCRIPT) {
+        coeffs = arena_alloc(scratch, valid_count * sizeof(scalar_t));
+        if (!coeffs) {
+            LOG_WARN("batch_verify: arena alloc failed, falling back to sequential");
+            arena_restore(scratch, cp);
+            for (size_t i = 0; i < batch->count; i++) {
+                if (batch->results[i] == VERIFY_OK) {
+                    batch->results[i] = verify_proof_ex(batch->ctx, &batch->proofs[i]);
+                }
+            }
+            return true;
         }
+        groth16_batch_coeffs(coeffs, seed_storage, batch->ctx->groth16_vk, g16_proofs,
+                             (const field_t **)pub_inputs, num_inputs, valid_count);
+        seed = seed_storage;
+    }
 
-        g16_proofs[j].c.is_infinity = point_is_infinity(&proof->proof_point_c);
-        if (!g16_proofs[j].c.is_infinity) {
-            field_copy(&g16_proofs[j].c.x, &proof->proof_point_c.x);
-            field_copy(&g16_proofs[j].c.y, &proof->proof_point_c.y);
+    /*
+     * The one validation pass: G1 curve checks per proof and every B in a
+     * single aggregate subgroup check. Failing proofs are malformed and
+     * leave the batch; the rest are compacted in place.
+     */
+    groth16_proofs_validate(valid_proofs, valid_flags, g16_proofs, valid_count,
+                            seed, batch->ctx->pool);
+    size_t m = 0;
+    for (j = 0; j < valid_count; j++) {
+        if (!valid_flags[j]) {
+            batch->results[valid_indices[j]] = VERIFY_MALFORMED;
+            continue;
         }
-
-        j++;
+        valid_proofs[m] = valid_proofs[j];
+        inputs_storage[m] = inputs_storage[j];
+        valid_indices[m] = valid_indices[j];
+        if (coeffs) coeffs[m] = coeffs[j];
+        m++;
+    }
+    valid_count = m;
+    if (valid_count == 0) {
+        arena_restore(scratch, cp);
+        return true;
     }
 
-    /* Call groth16_verify_batch */
-    bool batch_ok = groth16_verify_batch(
+    bool batch_ok = groth16_verify_batch_validated(
         batch->ctx->groth16_vk,
-        g16_proofs,
+        valid_proofs,
         (const field_t **)pub_inputs,
         num_inputs,
-        valid_count
+        valid_count,
+        coeffs,
+        batch->ctx->pool
     );
 
-    arena_restore(scratch, cp);
-
     if (!batch_ok) {
-        /* Batch failed - need to identify which proofs are invalid */
-        LOG_DEBUG("batch_verify: batch failed, verifying individually");
-        for (size_t i = 0; i < batch->count; i++) {
-            if (batch->results[i] == VERIFY_OK) {
-                batch->results[i] = verify_proof_ex(batch->ctx, &batch->proofs[i]);
-            }
-        }
+        /* Batch failed - isolate the invalid proofs by bisection */
+        LOG_DEBUG("batch_verify: batch failed, bisecting %zu proofs", valid_count);
+        batch_bisect_t bisect = {
+            .ctx = batch->ctx,
+            .proofs = valid_proofs,
+            .pub_inputs = (const field_t **)pub_inputs,
+            .num_inputs = num_inputs,
+            .valid_indices = valid_indices,
+            .coeffs = coeffs,
+            .results = batch->results,
+        };
+        batch_bisect(&bisect, 0, valid_count, true);
     }
 
+    arena_restore(scratch, cp);
+
     LOG_DEBUG("batch_verify: completed %zu proofs", batch->count);
     return true;
 }
@@ -8,7 +8,10 @@
 #define TETSUO_VERIFY_H
 
 #include "field.h"
+#include "scalar.h"
+#include "threadpool.h"
 #include "arena.h"
+#include "pairing.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -47,17 +50,11 @@ typedef struct {
     uint8_t proof_data[256];
 } __attribute__((packed)) proof_wire_t;
 
-/*
- * G2 point coordinates for proof B point (twist curve over Fp2)
- * Each coordinate is Fp2 = Fp[u]/(u^2 + 1), stored as (real, imag)
- */
-typedef struct {
-    field_t x_re;
-    field_t x_im;
-    field_t y_re;
-    field_t y_im;
-    bool is_infinity;
-} proof_g2_t;
+/* Batch coefficient source */
+typedef enum {
+    BATCH_COEFFS_RANDOM = 0,        /* Per-thread CSPRNG */
+    BATCH_COEFFS_TRANSCRIPT = 1,    /* Fiat-Shamir over the batch: coefficients and G2 check, no RNG */
+} batch_coeffs_mode_t;
 
 /* Expanded proof for verification */
 typedef struct {
@@ -67,14 +64,9 @@ typedef struct {
     field_t agent_pk;
     field_t commitment;
     field_t nullifier;
-    point_t proof_point_a;      /* G1 */
-    proof_g2_t proof_point_b;   /* G2 (4 field elements) */
-    point_t proof_point_c;      /* G1 */
+    groth16_proof_t points;     /* A, C ∈ G1, B ∈ G2: decoded, not yet validated */
 } proof_t;
 
-/* Forward declaration for Groth16 VK */
-struct groth16_vk;
-
 /* Verification context */
 typedef struct {
     arena_t *arena;
@@ -92,6 +84,9 @@ typedef struct {
     size_t vk_ic_len;
     /* Groth16 verification key (for pairing-based verification) */
     struct groth16_vk *groth16_vk;
+    /* Batch verification workers (NULL = calling thread only) */
+    threadpool_t *pool;
+    batch_coeffs_mode_t batch_coeffs;
 } verify_ctx_t;
 
 /* Batch verification state */
@@ -101,11 +96,6 @@ typedef struct {
     verify_result_t *results;
     size_t count;
     size_t capacity;
-    /* Randomness for batch verification */
-    field_t *randoms;
-    /* Accumulated pairing inputs */
-    point_t *acc_g1;
-    point_t *acc_g2;
 } batch_ctx_t;
 
 /* Context management */
@@ -130,6 +120,40 @@ void batch_reset(batch_ctx_t *batch);
 bool proof_parse(proof_t *out, const proof_wire_t *wire);
 bool proof_serialize(proof_wire_t *out, const proof_t *proof);
 
+/* G1 arithmetic on Jacobian points (infinity has Z = 0) */
+void point_set_infinity(point_t *p);
+bool point_is_infinity(const point_t *p);
+void point_add(point_t *r, const point_t *p, const point_t *q);
+void point_double(point_t *r, const point_t *p);
+void point_to_affine(point_t *r, const point_t *p);
+
+/* Mixed addition: q must be affine (Z = 1) or infinity */
+void point_add_affine(point_t *r, const point_t *p, const point_t *q);
+
+/*
+ * r[i] = affine p[i] for all n with one field_batch_inv (Montgomery's
+ * trick) instead of n inversions. r may alias p.
+ */
+void point_batch_to_affine(point_t *r, const point_t *p, size_t n);
+
+/*
+ * Scalars are Montgomery-form scalar_t. point_mul is the constant-time
+ * ladder, for secret scalars. The _vartime functions and point_msm leak
+ * the scalar (and inverse) through timing: verification data only.
+ */
+void point_mul(point_t *r, const point_t *p, const scalar_t *k);
+void point_mul_vartime(point_t *r, const point_t *p, const scalar_t *k);
+void point_to_affine_vartime(point_t *r, const point_t *p);
+void point_msm(point_t *r, const point_t *points, const scalar_t *scalars, size_t n,
+               threadpool_t *pool);
+
+/*
+ * Poseidon over n independent inputs of `arity` Montgomery elements each:
+ * out[i] = H(inputs[i·arity .. i·arity + arity)). Uses the 8-lane IFMA
+ * kernel when available; results match poseidon_hash_public exactly.
+ */
+void poseidon_hash_many(field_t *out, const field_t *inputs, size_t arity, size_t n);
+
 /* Utility */
 void compute_nullifier(field_t *out, const field_t *agent_pk, uint64_t nonce);
 bool verify_exclusion_proof(const uint8_t *root, const field_t *leaf,
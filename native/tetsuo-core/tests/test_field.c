@@ -3,6 +3,9 @@
  */
 
 #include "../src/field.h"
+#include "../src/scalar.h"
+#include "../src/mont.h"
+#include "../src/tetsuo.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -16,6 +19,15 @@
         printf("OK\n"); \
     } while (0)
 
+/* Like assert, but still evaluated and enforced under NDEBUG */
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            abort(); \
+        } \
+    } while (0)
+
 static void test_add_identity(void) {
     field_t a, zero, result;
 
@@ -135,6 +147,63 @@ static void test_inv(void) {
     assert(field_eq(&result, &one));
 }
 
+/* safegcd (both variants) against a^(p-2), including edge values */
+static void test_inv_safegcd(void) {
+    static const uint64_t p_minus_2[4] = {
+        0x3C208C16D87CFD45ULL, 0x97816A916871CA8DULL,
+        0xB85045B68181585DULL, 0x30644E72E131A029ULL
+    };
+    field_t a, ref, ct, vt, one;
+    field_set_one(&one);
+
+    field_set_zero(&a);
+    field_inv(&ct, &a);
+    field_inv_vartime(&vt, &a);
+    assert(field_is_zero(&ct) && field_is_zero(&vt));
+
+    uint64_t x = 0x2545F4914F6CDD1DULL;
+    for (int iter = 0; iter < 500; iter++) {
+        if (iter == 0) {
+            field_set_one(&a);
+        } else if (iter == 1) {
+            field_neg(&a, &one);
+        } else if (iter < 10) {
+            /* Sparse plain values: 2^k, small integers */
+            memset(&a, 0, sizeof(a));
+            a.limbs[iter % 4] = 1ULL << (iter * 7);
+            field_to_mont(&a, &a);
+        } else {
+            for (int i = 0; i < 4; i++) {
+                x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+                a.limbs[i] = x;
+            }
+            a.limbs[3] %= FIELD_MODULUS[3];
+        }
+
+        field_pow(&ref, &a, p_minus_2, 4);
+        field_inv(&ct, &a);
+        field_inv_vartime(&vt, &a);
+        assert(field_eq(&ct, &ref));
+        assert(field_eq(&vt, &ref));
+    }
+
+    scalar_t s, s_inv, s_one, prod;
+    fr_set_one(&s_one);
+    fr_set_zero(&s);
+    fr_inv(&s_inv, &s);
+    assert(fr_is_zero(&s_inv));
+    for (int iter = 0; iter < 200; iter++) {
+        for (int i = 0; i < 4; i++) {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+            s.limbs[i] = x;
+        }
+        s.limbs[3] %= SCALAR_MODULUS[3];
+        fr_inv(&s_inv, &s);
+        fr_mul(&prod, &s, &s_inv);
+        assert(fr_eq(&prod, &s_one));
+    }
+}
+
 static void test_batch_inv(void) {
     field_t inputs[8], outputs[8], check[8], one;
 
@@ -155,6 +224,291 @@ static void test_batch_inv(void) {
     }
 }
 
+/* Sizes straddle the 8-lane groups; results match the scalar ops */
+static void test_batch_lanes(void) {
+    enum { N = 67 };
+    field_t a[N], b[N], c[N], inv[N], check, one;
+    uint64_t sa[5 * N], sb[5 * N], sc[5 * N];
+
+    for (int i = 0; i < N; i++) {
+        a[i].limbs[0] = 0x9e3779b97f4a7c15ULL * (i + 1);
+        a[i].limbs[1] = i;
+        a[i].limbs[2] = 0;
+        a[i].limbs[3] = 0x0f00ULL * i;
+        b[i].limbs[0] = i + 11;
+        b[i].limbs[1] = 0xdeadbeefULL * i;
+        b[i].limbs[2] = i * i;
+        b[i].limbs[3] = 0;
+        field_to_mont(&a[i], &a[i]);
+        field_to_mont(&b[i], &b[i]);
+    }
+    field_set_one(&one);
+
+    for (size_t n = 0; n <= N; n += (n < 20 ? 1 : 9)) {
+        field_batch_mul(c, a, b, n);
+        for (size_t i = 0; i < n; i++) {
+            field_mul(&check, &a[i], &b[i]);
+            assert(field_eq(&c[i], &check));
+        }
+
+        field_batch_inv(inv, a, n);
+        for (size_t i = 0; i < n; i++) {
+            field_mul(&check, &a[i], &inv[i]);
+            assert(field_eq(&check, &one));
+        }
+
+        field_to_soa52(sa, a, n);
+        field_to_soa52(sb, b, n);
+        field_batch_mul_soa52(sc, sa, sb, n);
+        field_from_soa52(inv, sc, n);
+        for (size_t i = 0; i < n; i++) {
+            assert(field_eq(&inv[i], &c[i]));
+        }
+    }
+
+    /* In place */
+    memcpy(c, a, sizeof(c));
+    field_batch_mul(c, c, b, N);
+    field_batch_inv(c, c, N);
+    for (int i = 0; i < N; i++) {
+        field_mul(&check, &a[i], &b[i]);
+        field_mul(&check, &check, &c[i]);
+        assert(field_eq(&check, &one));
+    }
+}
+
+/* Lazy-reduced sums match field_mul + field_add, including all-(p-1) input */
+static void test_sum_of_products(void) {
+    enum { N = 13 };
+    field_t a[N], b[N], r, check, prod;
+    uint64_t x = 0x2545F4914F6CDD1DULL;
+
+    for (int pass = 0; pass < 2; pass++) {
+        for (int i = 0; i < N; i++) {
+            if (pass == 0) {
+                /* Largest reduced value: the worst case for the accumulator */
+                memcpy(&a[i], FIELD_MODULUS, sizeof(a[i]));
+                a[i].limbs[0]--;
+                b[i] = a[i];
+            } else {
+                for (int k = 0; k < 4; k++) {
+                    x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+                    a[i].limbs[k] = x;
+                    x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+                    b[i].limbs[k] = x;
+                }
+                a[i].limbs[3] %= FIELD_MODULUS[3];
+                b[i].limbs[3] %= FIELD_MODULUS[3];
+            }
+        }
+
+        for (size_t n = 0; n <= N; n++) {
+            field_set_zero(&check);
+            for (size_t i = 0; i < n; i++) {
+                field_mul(&prod, &a[i], &b[i]);
+                field_add(&check, &check, &prod);
+            }
+            field_sum_of_products(&r, a, b, n);
+            assert(field_eq(&r, &check));
+
+            /* Same sum through the wide primitives */
+            if (n >= 1 && n <= FIELD_WIDE_MAX_TERMS) {
+                field_wide_t acc;
+                field_wide_mul(&acc, &a[0], &b[0]);
+                for (size_t i = 1; i < n; i++) field_wide_mac(&acc, &a[i], &b[i]);
+                field_wide_reduce(&r, &acc);
+                assert(field_eq(&r, &check));
+            }
+        }
+
+        /* a0·b0 - a1·b1 in both orders, so both borrow cases run */
+        field_wide_t w0, w1, d;
+        field_t m0, m1;
+        field_mul(&m0, &a[0], &b[0]);
+        field_mul(&m1, &a[1], &b[1]);
+        field_wide_mul(&w0, &a[0], &b[0]);
+        field_wide_mul(&w1, &a[1], &b[1]);
+
+        field_wide_sub(&d, &w0, &w1);
+        field_wide_reduce(&r, &d);
+        field_sub(&check, &m0, &m1);
+        assert(field_eq(&r, &check));
+
+        field_wide_sub(&d, &w1, &w0);
+        field_wide_reduce(&r, &d);
+        field_sub(&check, &m1, &m0);
+        assert(field_eq(&r, &check));
+
+        field_wide_add(&d, &w0, &w1);
+        field_wide_reduce(&r, &d);
+        field_add(&check, &m0, &m1);
+        assert(field_eq(&r, &check));
+    }
+
+    /* Aliasing the output with an input */
+    field_sum_of_products(&check, a, b, 3);
+    field_sum_of_products(&a[0], a, b, 3);
+    assert(field_eq(&a[0], &check));
+}
+
+/* Both multiply kernels agree; the feature query matches the CPU */
+static void test_cpu_dispatch(void) {
+    uint32_t f = cpu_features();
+    uint32_t selected = tetsuo_cpu_features();
+    CHECK(((selected & TETSUO_CPU_AVX512_IFMA) != 0) == ((f & CPU_AVX512IFMA) != 0));
+
+#ifdef TETSUO_X64_ASM
+    CHECK(((selected & TETSUO_CPU_MULX_ADX) != 0) == ((f & CPU_MULX_ADX) == CPU_MULX_ADX));
+    if ((f & CPU_MULX_ADX) != CPU_MULX_ADX) return;
+
+    uint64_t x = 0x9e3779b97f4a7c15ULL;
+    for (int iter = 0; iter < 1000; iter++) {
+        uint64_t a[4], b[4], t1[8], t2[8], r1[4], r2[4];
+        for (int i = 0; i < 4; i++) {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+            a[i] = x;
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+            b[i] = x;
+        }
+        a[3] %= FIELD_MODULUS[3];
+        b[3] %= FIELD_MODULUS[3];
+
+        mont_mul_256x256_c(t1, a, b);
+        mont_mul_256x256_adx(t2, a, b);
+        CHECK(memcmp(t1, t2, sizeof(t1)) == 0);
+        mont_reduce_c(r1, t1, FIELD_MODULUS, FIELD_INV);
+        mont_reduce_adx(r2, t2, FIELD_MODULUS, FIELD_INV);
+        CHECK(memcmp(r1, r2, sizeof(r1)) == 0);
+
+        mont_sqr_256_c(t1, a);
+        mont_sqr_256_adx(t2, a);
+        CHECK(memcmp(t1, t2, sizeof(t1)) == 0);
+    }
+#else
+    CHECK(!(selected & TETSUO_CPU_MULX_ADX));
+#endif
+}
+
+/* Fp2 against schoolbook formulas and the u² = -1 identities */
+static void test_fp2(void) {
+    fp2_t a, b, r, check, one;
+    field_t t0, t1;
+    uint64_t x = 0x9e3779b97f4a7c15ULL;
+
+    /* (1 + 2u)(3 + 4u) = -5 + 10u */
+    field_t v[5];
+    for (int i = 0; i < 5; i++) {
+        field_set_zero(&v[i]);
+        v[i].limbs[0] = (uint64_t)(i + 1);
+        field_to_mont(&v[i], &v[i]);
+    }
+    a.c0 = v[0]; a.c1 = v[1];
+    b.c0 = v[2]; b.c1 = v[3];
+    fp2_mul(&r, &a, &b);
+    field_neg(&t0, &v[4]);
+    field_add(&t1, &v[4], &v[4]);
+    assert(field_eq(&r.c0, &t0) && field_eq(&r.c1, &t1));
+
+    fp2_set_one(&one);
+    for (int iter = 0; iter < 200; iter++) {
+        field_t *c[4] = {&a.c0, &a.c1, &b.c0, &b.c1};
+        for (int k = 0; k < 4; k++) {
+            for (int i = 0; i < 4; i++) {
+                x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+                c[k]->limbs[i] = x;
+            }
+            c[k]->limbs[3] %= FIELD_MODULUS[3];
+        }
+        if (iter == 0) {
+            /* Largest coefficients */
+            memcpy(&a.c0, FIELD_MODULUS, sizeof(a.c0));
+            a.c0.limbs[0]--;
+            a.c1 = a.c0;
+            b = a;
+        }
+
+        /* Schoolbook product */
+        field_t p00, p11, p01, p10;
+        field_mul(&p00, &a.c0, &b.c0);
+        field_mul(&p11, &a.c1, &b.c1);
+        field_mul(&p01, &a.c0, &b.c1);
+        field_mul(&p10, &a.c1, &b.c0);
+        field_sub(&check.c0, &p00, &p11);
+        field_add(&check.c1, &p01, &p10);
+        fp2_mul(&r, &a, &b);
+        assert(fp2_eq(&r, &check));
+
+        fp2_sqr(&r, &a);
+        fp2_mul(&check, &a, &a);
+        assert(fp2_eq(&r, &check));
+
+        /* Non-residue 9 + u */
+        fp2_t xi;
+        field_set_zero(&xi.c0);
+        xi.c0.limbs[0] = 9;
+        field_to_mont(&xi.c0, &xi.c0);
+        field_set_one(&xi.c1);
+        fp2_mul_by_nonresidue(&r, &a);
+        fp2_mul(&check, &a, &xi);
+        assert(fp2_eq(&r, &check));
+
+        /* a·a⁻¹ = 1; Frobenius is multiplicative and an involution */
+        fp2_inv(&r, &a);
+        fp2_mul(&r, &r, &a);
+        assert(fp2_eq(&r, &one));
+
+        fp2_t fa, fb;
+        fp2_frobenius(&fa, &a);
+        fp2_frobenius(&fb, &b);
+        fp2_mul(&check, &fa, &fb);
+        fp2_mul(&r, &a, &b);
+        fp2_frobenius(&r, &r);
+        assert(fp2_eq(&r, &check));
+        fp2_frobenius(&r, &fa);
+        assert(fp2_eq(&r, &a));
+
+        /* In place */
+        check = a;
+        fp2_mul(&check, &check, &check);
+        fp2_sqr(&r, &a);
+        assert(fp2_eq(&r, &check));
+    }
+
+    fp2_set_zero(&a);
+    fp2_inv(&r, &a);
+    assert(fp2_is_zero(&r));
+}
+
+/* Constant-time and early-exit comparisons agree */
+static void test_compare(void) {
+    static const uint64_t v[][4] = {
+        {0, 0, 0, 0},
+        {1, 0, 0, 0},
+        {0x8000000000000001ULL, 0, 0, 0},   /* limbs differing by >= 2^63 */
+        {0, 0, 0, 0x8000000000000000ULL},
+        {UINT64_MAX, UINT64_MAX, 0, 1},
+        {0, 0, 1, 1},
+    };
+    enum { N = sizeof(v) / sizeof(v[0]) };
+
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            field_t a, b;
+            memcpy(a.limbs, v[i], sizeof(a.limbs));
+            memcpy(b.limbs, v[j], sizeof(b.limbs));
+
+            int expect = 0;
+            for (int k = 3; k >= 0 && expect == 0; k--) {
+                if (v[i][k] != v[j][k]) expect = v[i][k] > v[j][k] ? 1 : -1;
+            }
+            assert(field_cmp(&a, &b) == expect);
+            assert(field_cmp_vartime(&a, &b) == expect);
+            assert(field_eq(&a, &b) == (expect == 0));
+            assert(field_eq_vartime(&a, &b) == (expect == 0));
+        }
+    }
+}
+
 static void test_serialization(void) {
     field_t original, restored;
     uint8_t bytes[32];
@@ -171,7 +525,7 @@ static void test_serialization(void) {
 }
 
 static void test_mont_roundtrip(void) {
-    field_t original, mont, restored;
+    field_t original, mont = {0}, restored;
 
     original.limbs[0] = 0x42ULL;
     original.limbs[1] = 0;
@@ -181,7 +535,70 @@ static void test_mont_roundtrip(void) {
     field_to_mont(&mont, &original);
     field_from_mont(&restored, &mont);
 
-    assert(field_eq(&original, &restored));
+    CHECK(field_eq(&original, &restored));
+}
+
+static void test_fr_mul_inv(void) {
+    scalar_t a, inv_a, result, one;
+
+    a.limbs[0] = 0x0123456789abcdefULL;
+    a.limbs[1] = 0xfedcba9876543210ULL;
+    a.limbs[2] = 0x1122334455667788ULL;
+    a.limbs[3] = 0x0badc0ffee000000ULL;
+    fr_to_mont(&a, &a);
+
+    fr_inv(&inv_a, &a);
+    fr_mul(&result, &a, &inv_a);
+    fr_set_one(&one);
+    assert(fr_eq(&result, &one));
+
+    fr_sqr(&result, &a);
+    fr_mul(&inv_a, &a, &a);
+    assert(fr_eq(&result, &inv_a));
+}
+
+static void test_fr_modulus_wrap(void) {
+    scalar_t minus_one, one, result;
+
+    /* (r - 1) + 1 = 0 mod r */
+    fr_set_one(&one);
+    fr_neg(&minus_one, &one);
+    fr_add(&result, &minus_one, &one);
+    assert(fr_is_zero(&result));
+
+    /* 0 - 1 = r - 1 */
+    fr_set_zero(&result);
+    fr_sub(&result, &result, &one);
+    assert(fr_eq(&result, &minus_one));
+
+    fr_from_mont(&result, &minus_one);
+    assert(result.limbs[0] == SCALAR_MODULUS[0] - 1);
+    assert(result.limbs[3] == SCALAR_MODULUS[3]);
+}
+
+static void test_fr_from_field(void) {
+    field_t p_minus_one, x;
+    scalar_t s, expected;
+
+    /* p - 1 lies in [r, 2r), so it reduces to p - r - 1 */
+    field_set_one(&x);
+    field_neg(&p_minus_one, &x);
+    fr_from_field(&s, &p_minus_one);
+
+    expected.limbs[0] = 0xF83E9682E87CFD45ULL;
+    expected.limbs[1] = 0x6F4D8248EEB859FBULL;
+    expected.limbs[2] = 0;
+    expected.limbs[3] = 0;
+    fr_to_mont(&expected, &expected);
+    assert(fr_eq(&s, &expected));
+
+    /* Values below r map unchanged */
+    x.limbs[0] = 0x42ULL;
+    x.limbs[1] = x.limbs[2] = x.limbs[3] = 0;
+    field_to_mont(&x, &x);
+    fr_from_field(&s, &x);
+    fr_from_u64(&expected, 0x42ULL);
+    assert(fr_eq(&s, &expected));
 }
 
 int main(void) {
@@ -196,9 +613,18 @@ int main(void) {
     TEST(mul_commutative);
     TEST(sqr_consistency);
     TEST(inv);
+    TEST(inv_safegcd);
     TEST(batch_inv);
+    TEST(batch_lanes);
+    TEST(sum_of_products);
+    TEST(cpu_dispatch);
+    TEST(fp2);
+    TEST(compare);
     TEST(serialization);
     TEST(mont_roundtrip);
+    TEST(fr_mul_inv);
+    TEST(fr_modulus_wrap);
+    TEST(fr_from_field);
 
     printf("\n════════════════════════════════════════════════\n");
     printf("All tests passed.\n\n");
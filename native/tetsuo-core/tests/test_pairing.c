@@ -4,6 +4,7 @@
 
 #include "pairing.h"
 #include "field.h"
+#include "verify.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -43,6 +44,210 @@ static int test_g2_infinity(void) {
     return g2_is_infinity(&p) == true;
 }
 
+/* Canonical big-endian-limb hex words -> Montgomery field_t */
+static void fp_set(field_t *r, uint64_t l3, uint64_t l2, uint64_t l1, uint64_t l0) {
+    r->limbs[0] = l0;
+    r->limbs[1] = l1;
+    r->limbs[2] = l2;
+    r->limbs[3] = l3;
+    field_to_mont(r, r);
+}
+
+/* Standard BN254 G2 generator */
+static void g2_generator(g2_t *g) {
+    fp_set(&g->x_re, 0x1800deef121f1e76ULL, 0x426a00665e5c4479ULL,
+           0x674322d4f75edaddULL, 0x46debd5cd992f6edULL);
+    fp_set(&g->x_im, 0x198e9393920d483aULL, 0x7260bfb731fb5d25ULL,
+           0xf1aa493335a9e712ULL, 0x97e485b7aef312c2ULL);
+    fp_set(&g->y_re, 0x12c85ea5db8c6debULL, 0x4aab71808dcb408fULL,
+           0xe3d1e7690c43d37bULL, 0x4ce6cc0166fa7daaULL);
+    fp_set(&g->y_im, 0x090689d0585ff075ULL, 0xec9e99ad690c3395ULL,
+           0xbc4b313370b38ef3ULL, 0x55acdadcd122975bULL);
+    g->is_infinity = false;
+}
+
+static bool g2_eq(const g2_t *a, const g2_t *b) {
+    if (a->is_infinity || b->is_infinity) return a->is_infinity == b->is_infinity;
+    return field_eq(&a->x_re, &b->x_re) && field_eq(&a->x_im, &b->x_im) &&
+           field_eq(&a->y_re, &b->y_re) && field_eq(&a->y_im, &b->y_im);
+}
+
+/* On the twist but outside the order-r subgroup: x = 1 */
+static void g2_outside_subgroup(g2_t *p) {
+    field_set_one(&p->x_re);
+    field_set_zero(&p->x_im);
+    fp_set(&p->y_re, 0x2869111d5381f072ULL, 0xf8e2728fdb825a51ULL,
+           0xaadd70e52c9830e9ULL, 0xab4b871c0531f1bbULL);
+    fp_set(&p->y_im, 0x0d1271953ed9ea08ULL, 0x36846e70a1934187ULL,
+           0x998c7f790cb4d751ULL, 0x1b7f8da82de048a4ULL);
+    p->is_infinity = false;
+}
+
+/* G + T with T of order 10069: only the small cofactor component is off */
+static void g2_small_order_component(g2_t *p) {
+    fp_set(&p->x_re, 0x17250faaafeabc32ULL, 0x0ff7c8486d0a26eaULL,
+           0x8c347d73d71970c6ULL, 0x22b92fcaef09d849ULL);
+    fp_set(&p->x_im, 0x17e5d224c5f68f03ULL, 0xc1abb67d16cf2f54ULL,
+           0x1bdd0284a402129eULL, 0x25b7ce3ff6e27ea8ULL);
+    fp_set(&p->y_re, 0x11c6123f1007dc08ULL, 0x117d7a8b6874ce3bULL,
+           0x558a701ace0fd890ULL, 0x06f071d46b5a1cc8ULL);
+    fp_set(&p->y_im, 0x093c8f136f4e51bbULL, 0x42f2c64351517fbaULL,
+           0xe12b146ceccd8376ULL, 0x3a1329870e0c0c81ULL);
+    p->is_infinity = false;
+}
+
+/* Native G2: known 2G, group laws, curve and subgroup membership */
+static int test_g2_native(void) {
+    g2_t g, g2, expected, neg, sum, bad;
+    g2_generator(&g);
+    if (!g2_is_on_curve(&g) || !g2_is_in_subgroup(&g)) return 0;
+
+    fp_set(&expected.x_re, 0x27dc7234fd11d3e8ULL, 0xc36c59277c3e6f14ULL,
+           0x9d5cd3cfa9a62aeeULL, 0x49f8130962b4b3b9ULL);
+    fp_set(&expected.x_im, 0x203e205db4f19b37ULL, 0xb60121b83a733370ULL,
+           0x6db86431c6d83584ULL, 0x9957ed8c3928ad79ULL);
+    fp_set(&expected.y_re, 0x04bb53b8977e5f92ULL, 0xa0bc372742c48309ULL,
+           0x44a59b4fe6b1c046ULL, 0x6e2a6dad122b5d2eULL);
+    fp_set(&expected.y_im, 0x195e8aa5b7827463ULL, 0x722b8c153931579dULL,
+           0x3505566b4edf48d4ULL, 0x98e185f0509de152ULL);
+    expected.is_infinity = false;
+
+    /* G + G takes the doubling branch */
+    g2_add(&g2, &g, &g);
+    if (!g2_eq(&g2, &expected)) return 0;
+
+    g2_jac_t j, jd;
+    g2_to_jac(&j, &g);
+    g2_jac_double(&jd, &j);
+    g2_jac_add(&jd, &jd, &j);            /* 3G, Z != 1 */
+    if (!g2_jac_is_on_curve(&jd)) return 0;
+    g2_from_jac(&sum, &jd);
+    g2_add(&g2, &g2, &g);
+    if (!g2_eq(&sum, &g2) || !g2_is_in_subgroup(&sum)) return 0;
+
+    /* ψ is a group endomorphism: ψ(3G) = 3ψ(G), and ψ(G) != G */
+    g2_jac_t pg, p3, pg3;
+    g2_jac_psi(&p3, &jd);
+    g2_jac_psi(&pg, &j);
+    if (!g2_jac_is_on_curve(&pg) || !g2_jac_is_on_curve(&p3)) return 0;
+    g2_jac_double(&pg3, &pg);
+    g2_jac_add(&pg3, &pg3, &pg);
+    g2_from_jac(&sum, &p3);
+    g2_from_jac(&g2, &pg3);
+    if (!g2_eq(&sum, &g2)) return 0;
+    g2_from_jac(&sum, &pg);
+    if (g2_eq(&sum, &g) || !g2_is_in_subgroup(&sum)) return 0;
+
+    /* G + (-G) = O */
+    g2_neg(&neg, &g);
+    g2_add(&sum, &g, &neg);
+    if (!g2_is_infinity(&sum)) return 0;
+
+    /* Off the curve */
+    bad = g;
+    field_add(&bad.y_re, &bad.y_re, &bad.x_re);
+    if (g2_is_on_curve(&bad)) return 0;
+
+    g2_outside_subgroup(&bad);
+    return g2_is_on_curve(&bad) && !g2_is_in_subgroup(&bad);
+}
+
+/* 64 points: 64-term batches take the aggregate path, 8-term ones do not */
+#define G2_BATCH_TEST_N 64
+
+static int test_g2_batch_subgroup(void) {
+    g2_t pts[G2_BATCH_TEST_N], g, bad, small;
+    bool valid[G2_BATCH_TEST_N];
+    uint8_t seed[GROTH16_BATCH_SEED_SIZE] = {0x5e, 0xed};
+    threadpool_t *pool = threadpool_create(4);
+
+    g2_generator(&g);
+    pts[0] = g;
+    for (size_t i = 1; i < G2_BATCH_TEST_N; i++) {
+        g2_add(&pts[i], &pts[i - 1], &g);
+    }
+    g2_outside_subgroup(&bad);
+    g2_small_order_component(&small);
+
+    int ok = g2_batch_is_in_subgroup(pts, G2_BATCH_TEST_N, NULL, NULL, NULL) &&
+             g2_batch_is_in_subgroup(pts, G2_BATCH_TEST_N, valid, NULL, pool) &&
+             g2_batch_is_in_subgroup(pts, 8, NULL, NULL, pool) &&
+             g2_batch_is_in_subgroup(pts, 0, NULL, NULL, pool) &&
+             g2_batch_is_in_subgroup(pts, G2_BATCH_TEST_N, NULL, seed, pool);
+    for (size_t i = 0; i < G2_BATCH_TEST_N; i++) ok &= valid[i];
+
+    /* A point outside G2, and one off only by an order-10069 term, are caught */
+    pts[7] = bad;
+    ok &= !g2_batch_is_in_subgroup(pts, G2_BATCH_TEST_N, NULL, NULL, pool);
+    ok &= !g2_batch_is_in_subgroup(pts, G2_BATCH_TEST_N, NULL, seed, pool);
+    ok &= !g2_batch_is_in_subgroup(pts, 8, NULL, NULL, NULL);
+    pts[7] = g;
+    pts[G2_BATCH_TEST_N - 1] = small;
+    for (int rep = 0; rep < 8; rep++) {
+        ok &= !g2_batch_is_in_subgroup(pts, G2_BATCH_TEST_N, NULL, NULL, pool);
+        seed[2] = (uint8_t)rep;
+        ok &= !g2_batch_is_in_subgroup(pts, G2_BATCH_TEST_N, NULL, seed, pool);
+    }
+
+    /* Flags name the bad points */
+    pts[3] = bad;
+    ok &= !g2_batch_is_in_subgroup(pts, G2_BATCH_TEST_N, valid, NULL, pool);
+    for (size_t i = 0; i < G2_BATCH_TEST_N; i++) {
+        ok &= valid[i] == (i != 3 && i != G2_BATCH_TEST_N - 1);
+    }
+
+    /* Off the twist */
+    pts[3] = g;
+    pts[G2_BATCH_TEST_N - 1] = g;
+    field_add(&pts[20].y_re, &pts[20].y_re, &pts[20].x_re);
+    ok &= !g2_batch_is_in_subgroup(pts, G2_BATCH_TEST_N, NULL, NULL, pool);
+
+    threadpool_destroy(pool);
+    return ok;
+}
+
+/* Validation stage: one proof, then a batch with per-proof flags */
+static int test_groth16_validate(void) {
+    groth16_proof_t proof, proofs[G2_BATCH_TEST_N];
+    groth16_valid_proof_t valid, valid_proofs[G2_BATCH_TEST_N];
+    bool flags[G2_BATCH_TEST_N];
+
+    /* G1 generator (1, 2) */
+    field_set_one(&proof.a.x);
+    field_add(&proof.a.y, &proof.a.x, &proof.a.x);
+    proof.a.is_infinity = false;
+    proof.c = proof.a;
+    g2_generator(&proof.b);
+
+    int ok = groth16_proof_validate(&valid, &proof) &&
+             g2_eq(&valid.proof.b, &proof.b) && field_eq(&valid.proof.a.x, &proof.a.x);
+
+    groth16_proof_t bad = proof;
+    field_add(&bad.c.y, &bad.c.y, &bad.c.x);
+    ok &= !groth16_proof_validate(&valid, &bad);
+    bad = proof;
+    g2_outside_subgroup(&bad.b);
+    ok &= !groth16_proof_validate(&valid, &bad);
+
+    for (size_t i = 0; i < G2_BATCH_TEST_N; i++) {
+        proofs[i] = proof;
+        if (i > 0) g2_add(&proofs[i].b, &proofs[i - 1].b, &proof.b);
+    }
+    ok &= groth16_proofs_validate(valid_proofs, flags, proofs, G2_BATCH_TEST_N, NULL, NULL);
+    ok &= groth16_proofs_validate(valid_proofs, NULL, proofs, G2_BATCH_TEST_N, NULL, NULL);
+
+    /* Bad G1 in one proof, small-order B component in another */
+    field_add(&proofs[5].a.y, &proofs[5].a.y, &proofs[5].a.x);
+    g2_small_order_component(&proofs[40].b);
+    ok &= !groth16_proofs_validate(valid_proofs, NULL, proofs, G2_BATCH_TEST_N, NULL, NULL);
+    ok &= !groth16_proofs_validate(valid_proofs, flags, proofs, G2_BATCH_TEST_N, NULL, NULL);
+    for (size_t i = 0; i < G2_BATCH_TEST_N; i++) {
+        ok &= flags[i] == (i != 5 && i != 40);
+    }
+    ok &= g2_eq(&valid_proofs[41].proof.b, &proofs[41].b);
+    return ok;
+}
+
 static int test_gt_identity(void) {
     /* Skip if pairing not available */
     if (!pairing_is_initialized()) return 1;
@@ -61,6 +266,107 @@ static int test_gt_identity(void) {
     return gt_is_one(&result);
 }
 
+static int test_gt_serialize_roundtrip(void) {
+    if (!pairing_is_initialized()) return 1;
+
+    g1_t g1_inf;
+    g2_t g2_inf;
+    gt_t one, back;
+    uint8_t buf[GT_SERIALIZED_SIZE];
+
+    g1_set_infinity(&g1_inf);
+    g2_set_infinity(&g2_inf);
+    if (!pairing_compute(&one, &g1_inf, &g2_inf)) return 0;
+
+    if (gt_serialize(buf, sizeof(buf), &one) != GT_SERIALIZED_SIZE) return 0;
+    if (!gt_deserialize(&back, buf, sizeof(buf))) return 0;
+
+    return gt_eq(&one, &back) && gt_is_one(&back);
+}
+
+static int test_g1_msm(void) {
+    /* Native path: runs without mcl */
+    g1_t g[3], r, expected;
+    scalar_t k[3], sum;
+
+    g[0].is_infinity = false;
+    field_set_zero(&g[0].x);
+    field_set_zero(&g[0].y);
+    g[0].x.limbs[0] = 1;
+    g[0].y.limbs[0] = 2;
+    field_to_mont(&g[0].x, &g[0].x);
+    field_to_mont(&g[0].y, &g[0].y);
+    g[1] = g[0];
+    g1_set_infinity(&g[2]);
+
+    fr_from_u64(&k[0], 0x1234567ULL);
+    fr_from_u64(&k[1], 0xfedcba9ULL);
+    fr_from_u64(&k[2], 0x5555ULL);
+    fr_add(&sum, &k[0], &k[1]);
+
+    g1_msm(&r, g, k, 3);
+    g1_msm(&expected, g, &sum, 1);
+
+    return !r.is_infinity && !expected.is_infinity &&
+           field_eq(&r.x, &expected.x) && field_eq(&r.y, &expected.y);
+}
+
+static int test_batch_coeffs(void) {
+    /* Native transcript path: runs without mcl */
+    groth16_vk_t vk;
+    memset(&vk, 0, sizeof(vk));
+    g1_t ic[2];
+    g1_set_infinity(&vk.alpha);
+    g2_set_infinity(&vk.beta);
+    g2_set_infinity(&vk.gamma);
+    g2_set_infinity(&vk.delta);
+    g1_set_infinity(&ic[0]);
+    g1_set_infinity(&ic[1]);
+    vk.ic = ic;
+    vk.ic_len = 2;
+
+    groth16_proof_t proofs[3];
+    memset(proofs, 0, sizeof(proofs));
+    field_t inputs[3];
+    const field_t *pub[3];
+    size_t num[3];
+    for (int i = 0; i < 3; i++) {
+        proofs[i].a.x.limbs[0] = (uint64_t)i + 1;
+        field_set_zero(&inputs[i]);
+        inputs[i].limbs[0] = 100 + (uint64_t)i;
+        pub[i] = &inputs[i];
+        num[i] = 1;
+    }
+
+    scalar_t c1[3], c2[3], plain;
+    uint8_t s1[GROTH16_BATCH_SEED_SIZE], s2[GROTH16_BATCH_SEED_SIZE];
+    groth16_batch_coeffs(c1, s1, &vk, proofs, pub, num, 3);
+    groth16_batch_coeffs(c2, s2, &vk, proofs, pub, num, 3);
+    if (memcmp(s1, s2, sizeof(s1)) != 0) return 0;
+
+    /* Reproducible, distinct, 128-bit */
+    for (int i = 0; i < 3; i++) {
+        if (!fr_eq(&c1[i], &c2[i])) return 0;
+        fr_from_mont(&plain, &c1[i]);
+        if (plain.limbs[2] || plain.limbs[3] || fr_is_zero(&plain)) return 0;
+    }
+    if (fr_eq(&c1[0], &c1[1]) || fr_eq(&c1[1], &c1[2])) return 0;
+
+    /* Any change to a public input changes every coefficient */
+    inputs[2].limbs[0] ^= 1;
+    groth16_batch_coeffs(c2, s2, &vk, proofs, pub, num, 3);
+    for (int i = 0; i < 3; i++) {
+        if (fr_eq(&c1[i], &c2[i])) return 0;
+    }
+    if (memcmp(s1, s2, sizeof(s1)) == 0) return 0;
+    inputs[2].limbs[0] ^= 1;
+
+    /* So does a change to the VK */
+    ic[1].is_infinity = false;
+    groth16_batch_coeffs(c2, NULL, &vk, proofs, pub, num, 3);
+    return !fr_eq(&c1[0], &c2[0]);
+}
+
 static int test_groth16_rejects_invalid(void) {
     /* Verify that groth16_verify rejects invalid proofs */
     if (!pairing_is_initialized()) return 1;
@@ -120,6 +426,213 @@ static int test_groth16_api_available(void) {
     return result == false;
 }
 
+/*
+ * Toy VK, prepared: alpha = IC[0] = IC[1] = G1 and beta = gamma = delta =
+ * G2 accept A = (3 + x)·G1, B = G2, C = G1 for public input x.
+ */
+static bool toy_vk_init(groth16_vk_t *vk, g1_t *g, g2_t *h) {
+    field_set_one(&g->x);
+    field_add(&g->y, &g->x, &g->x);
+    g->is_infinity = false;
+    g2_generator(h);
+
+    memset(vk, 0, sizeof(*vk));
+    vk->ic = malloc(2 * sizeof(g1_t));
+    if (!vk->ic) return false;
+    vk->ic_len = 2;
+    vk->alpha = vk->ic[0] = vk->ic[1] = *g;
+    vk->beta = vk->gamma = vk->delta = *h;
+    return vk_prepare(vk);
+}
+
+static void wire_put_fp(uint8_t *out, const field_t *a) {
+    field_t canon;
+    field_from_mont(&canon, a);
+    field_to_bytes(out, &canon);
+}
+
+/*
+ * Wire proof `id` for the toy VK, with x = Poseidon(agent_pk, commitment,
+ * threshold) as the verifier computes it. `corrupt` shifts A by one G1.
+ */
+static void toy_wire(proof_wire_t *w, const g1_t *g, const g2_t *h,
+                     uint8_t id, bool corrupt) {
+    memset(w, 0, sizeof(*w));
+    w->version = 1;
+    w->flags = 80;
+    w->agent_pk[31] = (uint8_t)(id + 1);
+    w->commitment[31] = 7;
+
+    proof_t parsed;
+    proof_parse(&parsed, w);
+    field_t in[3], x;
+    in[0] = parsed.agent_pk;
+    in[1] = parsed.commitment;
+    field_set_zero(&in[2]);
+    in[2].limbs[0] = 80;
+    field_to_mont(&in[2], &in[2]);
+    poseidon_hash_many(&x, in, 3, 1);
+
+    scalar_t k, off;
+    fr_from_field(&k, &x);
+    fr_from_u64(&off, corrupt ? 4 : 3);
+    fr_add(&k, &k, &off);
+    g1_t a;
+    g1_msm(&a, g, &k, 1);
+
+    uint8_t *d = w->proof_data;
+    wire_put_fp(d, &a.x);
+    wire_put_fp(d + 32, &a.y);
+    wire_put_fp(d + 64, &h->x_re);
+    wire_put_fp(d + 96, &h->x_im);
+    wire_put_fp(d + 128, &h->y_re);
+    wire_put_fp(d + 160, &h->y_im);
+    wire_put_fp(d + 192, &g->x);
+    wire_put_fp(d + 224, &g->y);
+}
+
+/* Twelve toy proofs on no pool span more than one Miller-loop chunk */
+static int test_groth16_batch_no_pool(void) {
+    if (!pairing_is_initialized()) return 1;
+
+    enum { N = 12 };
+    groth16_vk_t vk;
+    g1_t g;
+    g2_t h;
+    if (!toy_vk_init(&vk, &g, &h)) {
+        vk_free(&vk);
+        return 0;
+    }
+
+    groth16_proof_t proofs[N];
+    field_t inputs[N];
+    const field_t *pub[N];
+    size_t num[N];
+    for (size_t i = 0; i < N; i++) {
+        scalar_t k;
+        fr_from_u64(&k, 3 + 10 * (uint64_t)i);
+        g1_msm(&proofs[i].a, &g, &k, 1);
+        proofs[i].b = h;
+        proofs[i].c = g;
+        field_set_zero(&inputs[i]);
+        inputs[i].limbs[0] = 10 * (uint64_t)i;
+        field_to_mont(&inputs[i], &inputs[i]);
+        pub[i] = &inputs[i];
+        num[i] = 1;
+    }
+
+    int ok = groth16_verify(&vk, &proofs[N - 1], &inputs[N - 1], 1);
+    ok &= groth16_verify_batch(&vk, proofs, pub, num, N, NULL, NULL);
+
+    /* A wrong input in the last chunk must still be caught */
+    field_add(&inputs[N - 1], &inputs[N - 1], &g.x);
+    ok &= !groth16_verify_batch(&vk, proofs, pub, num, N, NULL, NULL);
+
+    vk_free(&vk);
+    return ok;
+}
+
+/* Batch and single paths agree on an all-zero (infinity) A */
+static int test_batch_rejects_infinity(void) {
+    if (!pairing_is_initialized()) return 1;
+
+    enum { N = 6, BAD = 2 };
+    groth16_vk_t vk;
+    g1_t g;
+    g2_t h;
+    if (!toy_vk_init(&vk, &g, &h)) {
+        vk_free(&vk);
+        return 0;
+    }
+    arena_t *arena = arena_create(1 << 16);
+    verify_ctx_t *ctx = arena ? verify_ctx_create(arena) : NULL;
+    batch_ctx_t *batch = ctx ? batch_create(ctx, N) : NULL;
+    int ok = batch != NULL;
+
+    proof_wire_t wires[N];
+    for (size_t i = 0; ok && i < N; i++) {
+        toy_wire(&wires[i], &g, &h, (uint8_t)i, false);
+        if (i == BAD) memset(wires[i].proof_data, 0, 64);
+        ok &= batch_add(batch, &wires[i]);
+    }
+
+    if (ok) {
+        ctx->groth16_vk = &vk;
+        ok &= verify_proof(ctx, &wires[BAD]) == VERIFY_INVALID_PROOF;
+        ok &= verify_proof(ctx, &wires[0]) == VERIFY_OK;
+        ok &= batch_verify(batch);
+        verify_result_t results[N];
+        batch_get_results(batch, results);
+        for (size_t i = 0; i < N; i++) {
+            ok &= results[i] == (i == BAD ? VERIFY_INVALID_PROOF : VERIFY_OK);
+        }
+    }
+
+    if (arena) arena_destroy(arena);
+    vk_free(&vk);
+    return ok;
+}
+
+/*
+ * A failing batch is bisected down to exactly the corrupted proofs:
+ * scattered, adjacent, and at either end, with and without a pool,
+ * under both coefficient sources.
+ */
+static int test_batch_bisect(void) {
+    if (!pairing_is_initialized()) return 1;
+
+    /* Large enough for the aggregate G2 check, seeded in transcript mode */
+    enum { N = G2_BATCH_TEST_N };
+    static const bool bad_sets[][N] = {
+        { [3] = true },
+        { [0] = true, [10] = true, [11] = true, [N - 1] = true },
+        { [5] = true, [6] = true, [7] = true, [8] = true, [9] = true },
+    };
+    groth16_vk_t vk;
+    g1_t g;
+    g2_t h;
+    if (!toy_vk_init(&vk, &g, &h)) {
+        vk_free(&vk);
+        return 0;
+    }
+    threadpool_t *pool = threadpool_create(4);
+    int ok = 1;
+
+    for (size_t t = 0; t < sizeof(bad_sets) / sizeof(bad_sets[0]); t++) {
+        for (int mode = 0; mode < 4; mode++) {
+            bool use_pool = mode & 1;
+            arena_t *arena = arena_create(1 << 16);
+            verify_ctx_t *ctx = arena ? verify_ctx_create(arena) : NULL;
+            batch_ctx_t *batch = ctx ? batch_create(ctx, N) : NULL;
+            if (!batch) {
+                ok = 0;
+                if (arena) arena_destroy(arena);
+                continue;
+            }
+            ctx->groth16_vk = &vk;
+            ctx->pool = use_pool ? pool : NULL;
+            ctx->batch_coeffs = mode & 2 ? BATCH_COEFFS_TRANSCRIPT : BATCH_COEFFS_RANDOM;
+
+            proof_wire_t wire;
+            for (size_t i = 0; i < N; i++) {
+                toy_wire(&wire, &g, &h, (uint8_t)i, bad_sets[t][i]);
+                ok &= batch_add(batch, &wire);
+            }
+            ok &= batch_verify(batch);
+            verify_result_t results[N];
+            batch_get_results(batch, results);
+            for (size_t i = 0; i < N; i++) {
+                ok &= results[i] == (bad_sets[t][i] ? VERIFY_INVALID_PROOF : VERIFY_OK);
+            }
+            arena_destroy(arena);
+        }
+    }
+
+    threadpool_destroy(pool);
+    vk_free(&vk);
+    return ok;
+}
+
 int main(void) {
     printf("\ntetsuo-core: Pairing Module Tests\n");
     printf("========================================================\n\n");
@@ -128,8 +641,17 @@ int main(void) {
     TEST(pairing_is_initialized);
     TEST(g1_infinity);
     TEST(g2_infinity);
+    TEST(g2_native);
+    TEST(g2_batch_subgroup);
+    TEST(groth16_validate);
     TEST(gt_identity);
+    TEST(gt_serialize_roundtrip);
+    TEST(g1_msm);
+    TEST(batch_coeffs);
     TEST(groth16_api_available);
+    TEST(groth16_batch_no_pool);
+    TEST(batch_rejects_infinity);
+    TEST(batch_bisect);
     TEST(groth16_rejects_invalid);
 
     printf("\n========================================================\n");
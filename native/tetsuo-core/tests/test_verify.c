@@ -6,11 +6,21 @@
 #include "../src/verify.h"
 #include "../src/arena.h"
 #include "../src/field.h"
+#include "../src/scalar.h"
+#include "../src/threadpool.h"
+#include "../src/rng.h"
+#include "../src/sha256.h"
+#include <stdatomic.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
 
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
 #define TEST(name) \
     do { \
         printf("  %-40s ", #name); \
@@ -19,6 +29,15 @@
         printf("OK\n"); \
     } while (0)
 
+/* Like assert, but still evaluated and enforced under NDEBUG */
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            abort(); \
+        } \
+    } while (0)
+
 static void test_ctx_create_destroy(void) {
     tetsuo_ctx_t *ctx = tetsuo_ctx_create(NULL);
     assert(ctx != NULL);
@@ -144,37 +163,50 @@ static void test_nullifier_deterministic(void) {
     assert(memcmp(nullifier1, nullifier2, 32) == 0);
 }
 
+/* Batch tests run under both coefficient sources */
+static const tetsuo_batch_coeffs_t COEFF_MODES[] = {
+    TETSUO_BATCH_COEFFS_RANDOM,
+    TETSUO_BATCH_COEFFS_TRANSCRIPT,
+};
+
 static void test_batch_empty(void) {
-    tetsuo_ctx_t *ctx = tetsuo_ctx_create(NULL);
-    tetsuo_batch_t *batch = tetsuo_batch_create(ctx, 256);
+    for (size_t m = 0; m < sizeof(COEFF_MODES) / sizeof(COEFF_MODES[0]); m++) {
+        tetsuo_config_t config = { .batch_coeffs = COEFF_MODES[m] };
+        tetsuo_ctx_t *ctx = tetsuo_ctx_create(&config);
+        tetsuo_batch_t *batch = tetsuo_batch_create(ctx, 256);
 
-    tetsuo_result_t r = tetsuo_batch_verify(batch);
-    assert(r == TETSUO_OK); (void)r;
+        tetsuo_result_t r = tetsuo_batch_verify(batch);
+        assert(r == TETSUO_OK); (void)r;
 
-    tetsuo_batch_destroy(batch);
-    tetsuo_ctx_destroy(ctx);
+        tetsuo_batch_destroy(batch);
+        tetsuo_ctx_destroy(ctx);
+    }
 }
 
 static void test_batch_add_verify(void) {
-    tetsuo_ctx_t *ctx = tetsuo_ctx_create(NULL);
-    tetsuo_batch_t *batch = tetsuo_batch_create(ctx, 256);
+    for (size_t m = 0; m < sizeof(COEFF_MODES) / sizeof(COEFF_MODES[0]); m++) {
+        tetsuo_config_t config = { .batch_coeffs = COEFF_MODES[m] };
+        tetsuo_ctx_t *ctx = tetsuo_ctx_create(&config);
+        tetsuo_batch_t *batch = tetsuo_batch_create(ctx, 256);
 
-    uint8_t agent_pk[32] = {1, 2, 3};
-    uint8_t commitment[32] = {4, 5, 6};
-    uint8_t proof_data[256];
-    memset(proof_data, 0x42, 256);
+        uint8_t agent_pk[32] = {1, 2, 3};
+        uint8_t commitment[32] = {4, 5, 6};
+        uint8_t proof_data[256];
+        memset(proof_data, 0x42, 256);
 
-    tetsuo_proof_t proof;
-    tetsuo_proof_create(&proof, TETSUO_PROOF_REPUTATION, 80, agent_pk, commitment, proof_data, 256);
+        tetsuo_proof_t proof;
+        tetsuo_proof_create(&proof, TETSUO_PROOF_REPUTATION, 80, agent_pk, commitment,
+                            proof_data, 256);
 
-    tetsuo_result_t r = tetsuo_batch_add(batch, &proof);
-    assert(r == TETSUO_OK); (void)r;
+        tetsuo_result_t r = tetsuo_batch_add(batch, &proof);
+        assert(r == TETSUO_OK); (void)r;
 
-    r = tetsuo_batch_verify(batch);
-    assert(r == TETSUO_OK);
+        r = tetsuo_batch_verify(batch);
+        assert(r == TETSUO_OK);
 
-    tetsuo_batch_destroy(batch);
-    tetsuo_ctx_destroy(ctx);
+        tetsuo_batch_destroy(batch);
+        tetsuo_ctx_destroy(ctx);
+    }
 }
 
 static void test_arena_basic(void) {
@@ -298,6 +330,435 @@ static void test_poseidon_circomlib_vector(void) {
     (void)match;
 }
 
+static void g1_generator(point_t *g) {
+    field_set_zero(&g->x);
+    field_set_zero(&g->y);
+    g->x.limbs[0] = 1;
+    g->y.limbs[0] = 2;
+    field_to_mont(&g->x, &g->x);
+    field_to_mont(&g->y, &g->y);
+    field_set_one(&g->z);
+}
+
+static void test_point_msm(void) {
+    point_t g, r, expected;
+    g1_generator(&g);
+
+    /* [2]G */
+    scalar_t two;
+    fr_from_u64(&two, 2);
+    point_msm(&r, &g, &two, 1, NULL);
+    point_to_affine(&r, &r);
+
+    field_t x2, y2;
+    x2.limbs[3] = 0x030644e72e131a02ULL; x2.limbs[2] = 0x9b85045b68181585ULL;
+    x2.limbs[1] = 0xd97816a916871ca8ULL; x2.limbs[0] = 0xd3c208c16d87cfd3ULL;
+    y2.limbs[3] = 0x15ed738c0e0a7c92ULL; y2.limbs[2] = 0xe7845f96b2ae9c0aULL;
+    y2.limbs[1] = 0x68a6a449e3538fc7ULL; y2.limbs[0] = 0xff3ebf7a5a18a2c4ULL;
+    field_to_mont(&x2, &x2);
+    field_to_mont(&y2, &y2);
+    CHECK(field_eq(&r.x, &x2));
+    CHECK(field_eq(&r.y, &y2));
+
+    /* Σ kᵢ·G == (Σ kᵢ)·G, large enough to use wider windows */
+    enum { N = 64 };
+    point_t points[N];
+    scalar_t scalars[N], total, k;
+    fr_set_zero(&total);
+    for (int i = 0; i < N; i++) {
+        points[i] = g;
+        fr_from_u64(&k, 0x9e3779b97f4a7c15ULL * (uint64_t)(i + 1));
+        fr_mul(&scalars[i], &k, &k);    /* spread over the full width */
+        fr_add(&total, &total, &scalars[i]);
+    }
+    point_msm(&r, points, scalars, N, NULL);
+    point_to_affine(&r, &r);
+    point_msm(&expected, &g, &total, 1, NULL);
+    point_to_affine(&expected, &expected);
+    CHECK(field_eq(&r.x, &expected.x));
+    CHECK(field_eq(&r.y, &expected.y));
+
+    /* k·G + (r-k)·G = O */
+    scalar_t pair[2];
+    point_t gg[2] = { g, g };
+    fr_copy(&pair[0], &scalars[7]);
+    fr_neg(&pair[1], &scalars[7]);
+    point_msm(&r, gg, pair, 2, NULL);
+    CHECK(field_is_zero(&r.z));
+}
+
+/* Ladder, wNAF and MSM agree, including 0, 1, -1 and mixed-sign digits */
+static void test_point_mul(void) {
+    point_t g, p, a, b;
+    scalar_t k[8];
+    g1_generator(&g);
+    point_double(&p, &g);
+    point_add(&p, &p, &g);      /* 3G, Z != 1 */
+
+    fr_set_zero(&k[0]);
+    fr_set_one(&k[1]);
+    fr_neg(&k[2], &k[1]);
+    fr_from_u64(&k[3], 0xF7F7F7F7F7F7F7F7ULL);
+    for (int i = 4; i < 8; i++) {
+        fr_from_u64(&k[i], 0x9e3779b97f4a7c15ULL * (uint64_t)(i + 1));
+        fr_sqr(&k[i], &k[i]);
+        fr_sqr(&k[i], &k[i]);
+    }
+
+    for (int i = 0; i < 8; i++) {
+        point_mul(&a, &p, &k[i]);
+        point_mul_vartime(&b, &p, &k[i]);
+        CHECK(point_is_infinity(&a) == point_is_infinity(&b));
+        if (point_is_infinity(&a)) {
+            CHECK(i == 0);
+            continue;
+        }
+        point_to_affine(&a, &a);
+        point_to_affine_vartime(&b, &b);
+        CHECK(field_eq(&a.x, &b.x) && field_eq(&a.y, &b.y));
+    }
+
+    /* (-1)·P = -P */
+    point_mul_vartime(&a, &p, &k[2]);
+    point_to_affine_vartime(&a, &a);
+    point_to_affine(&b, &p);
+    field_neg(&b.y, &b.y);
+    CHECK(field_eq(&a.x, &b.x) && field_eq(&a.y, &b.y));
+
+    /* GLV boundaries: λ, -λ, 2^128 - 1, 2^128 */
+    static const uint64_t edge[4][4] = {
+        {0x8b17ea66b99c90ddULL, 0x5bfc41088d8daaa7ULL, 0xb3c4d79d41a91758ULL, 0},
+        {0xb8ca0b2d36636f24ULL, 0xcc37a73fec2bc5e9ULL, 0x048b6e193fd84104ULL,
+         0x30644e72e131a029ULL},
+        {UINT64_MAX, UINT64_MAX, 0, 0},
+        {0, 0, 1, 0},
+    };
+    for (int i = 0; i < 4; i++) {
+        scalar_t e;
+        memcpy(e.limbs, edge[i], sizeof(e.limbs));
+        fr_to_mont(&e, &e);
+        point_mul(&a, &p, &e);
+        point_mul_vartime(&b, &p, &e);
+        point_to_affine(&a, &a);
+        point_to_affine(&b, &b);
+        CHECK(field_eq(&a.x, &b.x) && field_eq(&a.y, &b.y));
+    }
+
+    /* 128-bit randomizers (short path) and full-width scalars (GLV) */
+    enum { M = 24 };
+    point_t many[M];
+    scalar_t ks[M];
+    for (int pass = 0; pass < 2; pass++) {
+        point_t acc, t;
+        point_set_infinity(&acc);
+        for (int i = 0; i < M; i++) {
+            many[i] = (i % 3) ? p : g;
+            fr_from_u64(&ks[i], 0xabcdef12345ULL * (uint64_t)(i + 5));
+            fr_sqr(&ks[i], &ks[i]);
+            if (pass == 0) {
+                fr_from_mont(&ks[i], &ks[i]);
+                ks[i].limbs[2] = ks[i].limbs[3] = 0;
+                fr_to_mont(&ks[i], &ks[i]);
+            } else {
+                fr_sqr(&ks[i], &ks[i]);
+            }
+            point_mul(&t, &many[i], &ks[i]);
+            point_add(&acc, &acc, &t);
+        }
+        point_msm(&a, many, ks, M, NULL);
+        point_to_affine(&a, &a);
+        point_to_affine(&acc, &acc);
+        CHECK(field_eq(&a.x, &acc.x) && field_eq(&a.y, &acc.y));
+    }
+
+    /* MSM sizes on both sides of the Pippenger cutoff */
+    point_t pts[8];
+    for (int i = 0; i < 8; i++) pts[i] = (i & 1) ? p : g;
+    for (size_t n = 1; n <= 8; n++) {
+        point_t acc, t;
+        point_set_infinity(&acc);
+        for (size_t i = 0; i < n; i++) {
+            point_mul(&t, &pts[i], &k[i]);
+            point_add(&acc, &acc, &t);
+        }
+        point_msm(&a, pts, k, n, NULL);
+        point_to_affine(&a, &a);
+        point_to_affine(&acc, &acc);
+        CHECK(field_eq(&a.x, &acc.x) && field_eq(&a.y, &acc.y));
+    }
+}
+
+static bool point_eq_affine(const point_t *a, const point_t *b) {
+    point_t x, y;
+    if (point_is_infinity(a) || point_is_infinity(b)) {
+        return point_is_infinity(a) == point_is_infinity(b);
+    }
+    point_to_affine(&x, a);
+    point_to_affine(&y, b);
+    return field_eq(&x.x, &y.x) && field_eq(&x.y, &y.y);
+}
+
+/* Mixed addition and batch normalization against the generic formulas */
+static void test_point_mixed(void) {
+    point_t g, p, gj, neg, a, b, inf;
+    g1_generator(&g);
+    point_double(&p, &g);
+    point_add(&p, &p, &g);      /* 3G, Z != 1 */
+    point_set_infinity(&inf);
+
+    point_add_affine(&a, &p, &g);
+    point_add(&b, &p, &g);
+    CHECK(point_eq_affine(&a, &b));
+
+    /* G with Z = 2: the doubling and cancelling branches */
+    field_t z, z2;
+    field_set_one(&z);
+    field_add(&z, &z, &z);
+    field_sqr(&z2, &z);
+    field_mul(&gj.x, &g.x, &z2);
+    field_mul(&gj.y, &g.y, &z2);
+    field_mul(&gj.y, &gj.y, &z);
+    gj.z = z;
+    point_add_affine(&a, &gj, &g);
+    point_double(&b, &g);
+    CHECK(point_eq_affine(&a, &b));
+    neg = g;
+    field_neg(&neg.y, &neg.y);
+    point_add_affine(&a, &gj, &neg);
+    CHECK(point_is_infinity(&a));
+
+    /* Infinity on either side, and r aliasing p */
+    point_add_affine(&a, &inf, &g);
+    CHECK(point_eq_affine(&a, &g));
+    point_add_affine(&a, &p, &inf);
+    CHECK(point_eq_affine(&a, &p));
+    a = p;
+    point_add_affine(&a, &a, &g);
+    point_add(&b, &p, &g);
+    CHECK(point_eq_affine(&a, &b));
+
+    /* Enough points for the IFMA inversion path, with infinities mixed in */
+    enum { N = 40 };
+    point_t pts[N], norm[N];
+    pts[0] = p;
+    for (int i = 1; i < N; i++) {
+        point_add(&pts[i], &pts[i - 1], &g);
+    }
+    pts[5] = inf;
+    pts[N - 1] = inf;
+    point_batch_to_affine(norm, pts, N);
+    for (int i = 0; i < N; i++) {
+        CHECK(point_is_infinity(&norm[i]) == point_is_infinity(&pts[i]));
+        if (point_is_infinity(&pts[i])) continue;
+        CHECK(field_eq(&norm[i].z, &g.z));
+        CHECK(point_eq_affine(&norm[i], &pts[i]));
+    }
+    point_batch_to_affine(pts, pts, N);
+    for (int i = 0; i < N; i++) {
+        CHECK(point_eq_affine(&norm[i], &pts[i]));
+    }
+}
+
+static void sum_range(void *arg, size_t begin, size_t end) {
+    _Atomic(uint64_t) *sum = arg;
+    uint64_t local = 0;
+    for (size_t i = begin; i < end; i++) local += i;
+    atomic_fetch_add(sum, local);
+}
+
+/* Marks slot begin / 10 and records the widest range handed to fn */
+typedef struct {
+    size_t widest;
+    uint8_t slots[16];
+} chunk_log_t;
+
+static void log_chunk(void *arg, size_t begin, size_t end) {
+    chunk_log_t *log = arg;
+    if (end - begin > log->widest) log->widest = end - begin;
+    log->slots[begin / 10]++;
+}
+
+static void test_threadpool(void) {
+    threadpool_t *pool = threadpool_create(4);
+    CHECK(pool != NULL);
+    CHECK(threadpool_size(pool) == 4);
+
+    /* Repeated loops reuse the same workers; uneven tail chunk */
+    for (int round = 0; round < 50; round++) {
+        _Atomic(uint64_t) sum = 0;
+        size_t n = 10007;
+        threadpool_for(pool, n, 7, sum_range, &sum);
+        CHECK(atomic_load(&sum) == (uint64_t)n * (n - 1) / 2);
+    }
+
+    /* Parallel MSM matches the single-threaded result */
+    enum { N = 40 };
+    point_t g, points[N], r1, r2;
+    scalar_t scalars[N];
+    g1_generator(&g);
+    for (int i = 0; i < N; i++) {
+        points[i] = g;
+        fr_from_u64(&scalars[i], 0xabcdef12345ULL * (uint64_t)(i + 3));
+        fr_sqr(&scalars[i], &scalars[i]);
+    }
+    point_msm(&r1, points, scalars, N, NULL);
+    point_msm(&r2, points, scalars, N, pool);
+    point_to_affine(&r1, &r1);
+    point_to_affine(&r2, &r2);
+    CHECK(field_eq(&r1.x, &r2.x) && field_eq(&r1.y, &r2.y));
+
+    threadpool_destroy(pool);
+
+    /* NULL pool runs inline */
+    CHECK(threadpool_create(1) == NULL);
+    _Atomic(uint64_t) sum = 0;
+    threadpool_for(NULL, 100, 10, sum_range, &sum);
+    CHECK(atomic_load(&sum) == 4950);
+
+    /* ... one grain chunk per call, so per-chunk slots all fill */
+    chunk_log_t log = {0};
+    threadpool_for(NULL, 95, 10, log_chunk, &log);
+    bool chunked = log.widest == 10;
+    for (size_t i = 0; i < 16; i++) chunked &= log.slots[i] == (i < 10);
+    CHECK(chunked);
+}
+
+static void test_ctx_with_threads(void) {
+    tetsuo_config_t config = {0};
+    config.num_threads = 4;
+
+    tetsuo_ctx_t *ctx = tetsuo_ctx_create(&config);
+    CHECK(ctx != NULL);
+
+    tetsuo_batch_t *batch = tetsuo_batch_create(ctx, 16);
+    CHECK(batch != NULL);
+    CHECK(tetsuo_batch_verify(batch) == TETSUO_OK);
+
+    tetsuo_batch_destroy(batch);
+    tetsuo_ctx_destroy(ctx);
+}
+
+static void test_rng(void) {
+    uint8_t a[64], b[64];
+    CHECK(rng_bytes(a, sizeof(a)));
+    CHECK(rng_bytes(b, sizeof(b)));
+    CHECK(memcmp(a, b, sizeof(a)) != 0);
+
+    /* Draws across the reseed boundary */
+    static uint8_t big[RNG_RESEED_BYTES + 1000];
+    CHECK(rng_bytes(big, sizeof(big)));
+    CHECK(rng_bytes(a, sizeof(a)));
+
+    /* Coefficients are 128-bit, nonzero with overwhelming probability */
+    scalar_t rs[32], plain;
+    CHECK(rng_scalars128(rs, 32));
+    for (int i = 0; i < 32; i++) {
+        fr_from_mont(&plain, &rs[i]);
+        CHECK(plain.limbs[2] == 0 && plain.limbs[3] == 0);
+        CHECK(!fr_is_zero(&plain));
+    }
+    CHECK(!fr_eq(&rs[0], &rs[1]));
+
+#ifndef _WIN32
+    /* A forked child must not replay the parent's stream */
+    int fds[2] = {-1, -1};
+    CHECK(pipe(fds) == 0);
+    pid_t pid = fork();
+    CHECK(pid >= 0);
+    if (pid == 0) {
+        uint8_t c[32];
+        int ok = rng_bytes(c, sizeof(c)) && write(fds[1], c, sizeof(c)) == (ssize_t)sizeof(c);
+        _exit(ok ? 0 : 1);
+    }
+    uint8_t child[32], parent[32];
+    CHECK(read(fds[0], child, sizeof(child)) == (ssize_t)sizeof(child));
+    int status = 0;
+    CHECK(waitpid(pid, &status, 0) == pid);
+    CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    CHECK(rng_bytes(parent, sizeof(parent)));
+    CHECK(memcmp(child, parent, sizeof(child)) != 0);
+    close(fds[0]);
+    close(fds[1]);
+#endif
+}
+
+/* Outputs pinned from the plain round function; the optimized one must match */
+extern void poseidon_hash_public(field_t *out, const field_t *inputs, size_t count);
+
+static void test_poseidon_regression(void) {
+    static const struct { size_t count; uint64_t first; const char *hex; } vectors[] = {
+        { 1, 1, "1610da0f3bfe973a25300a5fb387d5ce25687188a0c715bfd7831451cde691d1" },
+        { 2, 2, "1c2f5715d031e5d4c83cd303c3969bc369bb2841d003c405edad5184988b1392" },
+        { 3, 3, "0d269536de382cd2dc23ae753616745d4274c640605a5f4fbb10e223102d5a6d" },
+    };
+    for (size_t v = 0; v < sizeof(vectors) / sizeof(vectors[0]); v++) {
+        field_t in[3], out;
+        for (size_t i = 0; i < 3; i++) {
+            field_set_zero(&in[i]);
+            in[i].limbs[0] = vectors[v].first + i;
+            field_to_mont(&in[i], &in[i]);
+        }
+        poseidon_hash_public(&out, in, vectors[v].count);
+        field_from_mont(&out, &out);
+
+        uint8_t bytes[32];
+        char hex[65];
+        field_to_bytes(bytes, &out);
+        for (int i = 0; i < 32; i++) snprintf(hex + 2 * i, 3, "%02x", bytes[i]);
+        CHECK(strcmp(hex, vectors[v].hex) == 0);
+    }
+}
+
+/* Multi-lane hashing matches the scalar permutation across group tails */
+static void test_poseidon_many(void) {
+    field_t in[40 * 3], out[40], ref;
+    for (size_t i = 0; i < 40 * 3; i++) {
+        field_set_zero(&in[i]);
+        in[i].limbs[0] = 0x9e3779b97f4a7c15ULL * (i + 1);
+        field_to_mont(&in[i], &in[i]);
+    }
+    for (size_t arity = 1; arity <= 3; arity++) {
+        for (size_t n = 0; n <= 20; n++) {
+            poseidon_hash_many(out, in, arity, n);
+            for (size_t i = 0; i < n; i++) {
+                poseidon_hash_public(&ref, &in[i * arity], arity);
+                CHECK(field_eq(&out[i], &ref));
+            }
+        }
+    }
+}
+
+static void test_sha256_vectors(void) {
+    static const struct { const char *msg; const char *hex; } vectors[] = {
+        { "", "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" },
+        { "abc", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" },
+        { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+          "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" },
+    };
+    for (size_t v = 0; v < sizeof(vectors) / sizeof(vectors[0]); v++) {
+        uint8_t digest[SHA256_DIGEST_SIZE];
+        char hex[2 * SHA256_DIGEST_SIZE + 1];
+        sha256(digest, vectors[v].msg, strlen(vectors[v].msg));
+        for (int i = 0; i < SHA256_DIGEST_SIZE; i++) {
+            snprintf(hex + 2 * i, 3, "%02x", digest[i]);
+        }
+        CHECK(strcmp(hex, vectors[v].hex) == 0);
+    }
+
+    /* Streaming across block boundaries matches one-shot */
+    uint8_t msg[200], a[SHA256_DIGEST_SIZE], b[SHA256_DIGEST_SIZE];
+    for (int i = 0; i < 200; i++) msg[i] = (uint8_t)(i * 7);
+    sha256(a, msg, sizeof(msg));
+    sha256_ctx_t h;
+    sha256_init(&h);
+    sha256_update(&h, msg, 1);
+    sha256_update(&h, msg + 1, 63);
+    sha256_update(&h, msg + 64, 100);
+    sha256_update(&h, msg + 164, 36);
+    sha256_final(&h, b);
+    CHECK(memcmp(a, b, sizeof(a)) == 0);
+}
+
 int main(void) {
     printf("\n");
     printf("tetsuo-core: Verification Engine Tests\n");
@@ -321,6 +782,15 @@ int main(void) {
     TEST(point_infinity);
     TEST(poseidon_consistency);
     TEST(poseidon_circomlib_vector);
+    TEST(poseidon_regression);
+    TEST(poseidon_many);
+    TEST(sha256_vectors);
+    TEST(point_msm);
+    TEST(point_mul);
+    TEST(point_mixed);
+    TEST(threadpool);
+    TEST(ctx_with_threads);
+    TEST(rng);
 
     tetsuo_cleanup();
 
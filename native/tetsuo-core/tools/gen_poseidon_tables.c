@@ -0,0 +1,338 @@
+/*
+ * Poseidon table generator
+ *
+ * Reads the round constants and MDS matrix from poseidon_constants.h and
+ * writes src/poseidon_tables.h: every table the hash needs, already in
+ * Montgomery form, including the optimized partial-round constants and
+ * sparse matrices. With a second path it also writes the same tables in
+ * the 5x52-bit radix (R = 2^260) used by the IFMA lanes kernel.
+ * Rerun after changing poseidon_constants.h:
+ *
+ *   cmake --build build --target poseidon_tables
+ *   make poseidon-tables
+ */
+
+#include "field.h"
+#include "poseidon_constants.h"
+#include <stdio.h>
+#include <string.h>
+
+#define HALF_FULL 4
+#define PARTIAL (POSEIDON_NUM_ROUNDS - 2 * HALF_FULL)
+
+static field_t rc[POSEIDON_NUM_ROUNDS][3];
+static field_t mds[3][3];
+static field_t full_rc[2 * HALF_FULL][3];
+static field_t partial_rc[PARTIAL];
+static field_t sparse_w[PARTIAL - 1][3];
+static field_t sparse_v[PARTIAL - 1][2];
+static field_t mds_last[3][3];
+
+/* r = a·b for 3x3 matrices */
+static void mat3_mul(field_t r[3][3], field_t a[3][3], field_t b[3][3]) {
+    field_t tmp[3][3], prod;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            field_set_zero(&tmp[i][j]);
+            for (int k = 0; k < 3; k++) {
+                field_mul(&prod, &a[i][k], &b[k][j]);
+                field_add(&tmp[i][j], &tmp[i][j], &prod);
+            }
+        }
+    }
+    memcpy(r, tmp, sizeof(tmp));
+}
+
+/*
+ * Constants: in a partial round only state[0] passes through the S-box,
+ * so the state[1..2] part of its constant commutes with it and can be
+ * pushed through the MDS into the next round. Carried forward across all
+ * partial rounds, each keeps a single scalar and the remainder lands in
+ * the first trailing full round.
+ */
+static void fold_constants(void) {
+    field_t acc[3], v[3], tmp[3], prod;
+
+    for (int r = 0; r < HALF_FULL; r++) {
+        memcpy(full_rc[r], rc[r], sizeof(rc[r]));
+    }
+
+    field_set_zero(&acc[0]);
+    field_set_zero(&acc[1]);
+    field_set_zero(&acc[2]);
+    for (int i = 0; i < PARTIAL; i++) {
+        for (int j = 0; j < 3; j++) {
+            field_add(&v[j], &rc[HALF_FULL + i][j], &acc[j]);
+        }
+        field_copy(&partial_rc[i], &v[0]);
+
+        /* acc = MDS · (0, v1, v2) */
+        for (int j = 0; j < 3; j++) {
+            field_mul(&tmp[j], &mds[j][1], &v[1]);
+            field_mul(&prod, &mds[j][2], &v[2]);
+            field_add(&tmp[j], &tmp[j], &prod);
+        }
+        memcpy(acc, tmp, sizeof(acc));
+    }
+
+    for (int r = 0; r < HALF_FULL; r++) {
+        memcpy(full_rc[HALF_FULL + r], rc[HALF_FULL + PARTIAL + r], sizeof(rc[0]));
+    }
+    for (int j = 0; j < 3; j++) {
+        field_add(&full_rc[HALF_FULL][j], &full_rc[HALF_FULL][j], &acc[j]);
+    }
+}
+
+/*
+ * Matrices: with N = [[a, bᵀ], [c, D]], N = diag(1, D) · S where
+ * S = [[a, bᵀ], [D⁻¹c, I]] is sparse. diag(1, D) leaves state[0] alone,
+ * so it commutes with the next partial round's constant and S-box and
+ * merges into that round's MDS. The last partial round applies the
+ * accumulated dense matrix.
+ */
+static void factor_matrices(void) {
+    field_t n[3][3], deferred[3][3], prod;
+
+    memset(deferred, 0, sizeof(deferred));
+    field_set_one(&deferred[0][0]);
+    field_set_one(&deferred[1][1]);
+    field_set_one(&deferred[2][2]);
+
+    for (int i = 0; i < PARTIAL - 1; i++) {
+        mat3_mul(n, mds, deferred);
+
+        /* D⁻¹ for the lower-right 2x2 block */
+        field_t det, inv_det, dinv[2][2];
+        field_mul(&det, &n[1][1], &n[2][2]);
+        field_mul(&prod, &n[1][2], &n[2][1]);
+        field_sub(&det, &det, &prod);
+        field_inv(&inv_det, &det);
+        field_mul(&dinv[0][0], &n[2][2], &inv_det);
+        field_mul(&dinv[1][1], &n[1][1], &inv_det);
+        field_mul(&dinv[0][1], &n[1][2], &inv_det);
+        field_neg(&dinv[0][1], &dinv[0][1]);
+        field_mul(&dinv[1][0], &n[2][1], &inv_det);
+        field_neg(&dinv[1][0], &dinv[1][0]);
+
+        field_copy(&sparse_w[i][0], &n[0][0]);
+        field_copy(&sparse_w[i][1], &n[0][1]);
+        field_copy(&sparse_w[i][2], &n[0][2]);
+        for (int j = 0; j < 2; j++) {
+            field_mul(&sparse_v[i][j], &dinv[j][0], &n[1][0]);
+            field_mul(&prod, &dinv[j][1], &n[2][0]);
+            field_add(&sparse_v[i][j], &sparse_v[i][j], &prod);
+        }
+
+        /* Carry diag(1, D) into the next round */
+        for (int j = 1; j < 3; j++) {
+            for (int k = 1; k < 3; k++) {
+                field_copy(&deferred[j][k], &n[j][k]);
+            }
+        }
+    }
+    mat3_mul(mds_last, mds, deferred);
+}
+
+static void emit_field(FILE *out, const field_t *f, const char *indent, const char *sep) {
+    fprintf(out, "%s{{0x%016llxULL, 0x%016llxULL, 0x%016llxULL, 0x%016llxULL}}%s\n", indent,
+            (unsigned long long)f->limbs[0], (unsigned long long)f->limbs[1],
+            (unsigned long long)f->limbs[2], (unsigned long long)f->limbs[3], sep);
+}
+
+static void emit_rows(FILE *out, field_t *rows, size_t num_rows, size_t width) {
+    for (size_t i = 0; i < num_rows; i++) {
+        fprintf(out, "    {\n");
+        for (size_t j = 0; j < width; j++) {
+            emit_field(out, &rows[i * width + j], "        ", j + 1 < width ? "," : "");
+        }
+        fprintf(out, "    }%s\n", i + 1 < num_rows ? "," : "");
+    }
+}
+
+/*
+ * Radix-2^52 Montgomery form: a·2^256 -> a·2^260 is four modular
+ * doublings, then the 256-bit value is split into five 52-bit limbs.
+ */
+static void to_r52(uint64_t out[5], const field_t *f, int doublings) {
+    field_t g;
+    field_copy(&g, f);
+    for (int i = 0; i < doublings; i++) field_add(&g, &g, &g);
+
+    const uint64_t mask = (1ULL << 52) - 1;
+    out[0] = g.limbs[0] & mask;
+    out[1] = ((g.limbs[0] >> 52) | (g.limbs[1] << 12)) & mask;
+    out[2] = ((g.limbs[1] >> 40) | (g.limbs[2] << 24)) & mask;
+    out[3] = ((g.limbs[2] >> 28) | (g.limbs[3] << 36)) & mask;
+    out[4] = g.limbs[3] >> 16;
+}
+
+static void emit_r52(FILE *out, const field_t *f, int doublings, const char *indent,
+                     const char *sep) {
+    uint64_t l[5];
+    to_r52(l, f, doublings);
+    fprintf(out, "%s{0x%013llxULL, 0x%013llxULL, 0x%013llxULL, 0x%013llxULL, 0x%013llxULL}%s\n",
+            indent, (unsigned long long)l[0], (unsigned long long)l[1],
+            (unsigned long long)l[2], (unsigned long long)l[3], (unsigned long long)l[4], sep);
+}
+
+static void emit_r52_rows(FILE *out, field_t *rows, size_t num_rows, size_t width) {
+    for (size_t i = 0; i < num_rows; i++) {
+        fprintf(out, "    {\n");
+        for (size_t j = 0; j < width; j++) {
+            emit_r52(out, &rows[i * width + j], 4, "        ", j + 1 < width ? "," : "");
+        }
+        fprintf(out, "    }%s\n", i + 1 < num_rows ? "," : "");
+    }
+}
+
+static void write_r52_tables(FILE *out) {
+    fprintf(out,
+        "/*\n"
+        " * Poseidon tables for the IFMA lanes kernel\n"
+        " *\n"
+        " * Five 52-bit limbs per element, Montgomery form with R = 2^260\n"
+        " * (see field_ifma.h).\n"
+        " * Generated by tools/gen_poseidon_tables.c from poseidon_constants.h.\n"
+        " * Do not edit.\n"
+        " */\n\n"
+        "#ifndef POSEIDON_TABLES_R52_H\n"
+        "#define POSEIDON_TABLES_R52_H\n\n"
+        "#include \"poseidon_tables.h\"\n"
+        "#include <stdint.h>\n\n");
+
+    fprintf(out, "static const _Alignas(CACHE_LINE_SIZE) uint64_t POSEIDON_MDS_R52[3][3][5] = {\n");
+    emit_r52_rows(out, &mds[0][0], 3, 3);
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "static const _Alignas(CACHE_LINE_SIZE) uint64_t POSEIDON_FULL_RC_R52[%d][3][5] = {\n",
+            2 * HALF_FULL);
+    emit_r52_rows(out, &full_rc[0][0], 2 * HALF_FULL, 3);
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "static const _Alignas(CACHE_LINE_SIZE) uint64_t POSEIDON_PARTIAL_RC_R52[%d][5] = {\n",
+            PARTIAL);
+    for (int i = 0; i < PARTIAL; i++) {
+        emit_r52(out, &partial_rc[i], 4, "    ", i + 1 < PARTIAL ? "," : "");
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "/* Sparse matrices as (w0, w1, w2, v0, v1) */\n");
+    fprintf(out, "static const _Alignas(CACHE_LINE_SIZE) uint64_t POSEIDON_SPARSE_R52[%d][5][5] = {\n",
+            PARTIAL - 1);
+    for (int i = 0; i < PARTIAL - 1; i++) {
+        fprintf(out, "    {\n");
+        for (int j = 0; j < 3; j++) emit_r52(out, &sparse_w[i][j], 4, "        ", ",");
+        emit_r52(out, &sparse_v[i][0], 4, "        ", ",");
+        emit_r52(out, &sparse_v[i][1], 4, "        ", "");
+        fprintf(out, "    }%s\n", i + 1 < PARTIAL - 1 ? "," : "");
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "static const _Alignas(CACHE_LINE_SIZE) uint64_t POSEIDON_MDS_LAST_R52[3][3][5] = {\n");
+    emit_r52_rows(out, &mds_last[0][0], 3, 3);
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "#endif /* POSEIDON_TABLES_R52_H */\n");
+}
+
+int main(int argc, char **argv) {
+    FILE *out = stdout;
+    if (argc > 1 && !(out = fopen(argv[1], "w"))) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    for (int i = 0; i < POSEIDON_NUM_ROUNDS; i++) {
+        for (int j = 0; j < 3; j++) {
+            hex_to_field(&rc[i][j], POSEIDON_RC_HEX[3 * i + j]);
+            field_to_mont(&rc[i][j], &rc[i][j]);
+        }
+    }
+    for (int j = 0; j < 3; j++) {
+        for (int k = 0; k < 3; k++) {
+            memcpy(mds[j][k].limbs, POSEIDON_MDS[j][k], sizeof(POSEIDON_MDS[j][k]));
+        }
+    }
+    fold_constants();
+    factor_matrices();
+
+    fprintf(out,
+        "/*\n"
+        " * Poseidon tables (t=3, R_F=8, R_P=57), Montgomery form\n"
+        " *\n"
+        " * Generated by tools/gen_poseidon_tables.c from poseidon_constants.h.\n"
+        " * Do not edit.\n"
+        " */\n\n"
+        "#ifndef POSEIDON_TABLES_H\n"
+        "#define POSEIDON_TABLES_H\n\n"
+        "#include \"field.h\"\n"
+        "#include \"arena.h\"\n\n"
+        "#define POSEIDON_HALF_FULL %d\n"
+        "#define POSEIDON_PARTIAL %d\n\n"
+        "/*\n"
+        " * Sparse partial-round matrix\n"
+        " *   [ w0  w1  w2 ]\n"
+        " *   [ v0  1   0  ]\n"
+        " *   [ v1  0   1  ]\n"
+        " */\n"
+        "typedef struct {\n"
+        "    field_t w[3];\n"
+        "    field_t v[2];\n"
+        "} poseidon_sparse_t;\n\n",
+        HALF_FULL, PARTIAL);
+
+    fprintf(out, "/* MDS matrix */\n");
+    fprintf(out, "static const _Alignas(CACHE_LINE_SIZE) field_t POSEIDON_MDS_MONT[3][3] = {\n");
+    emit_rows(out, &mds[0][0], 3, 3);
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "/* Full-round constants; row %d carries the folded partial-round remainder */\n",
+            HALF_FULL);
+    fprintf(out, "static const _Alignas(CACHE_LINE_SIZE) field_t POSEIDON_FULL_RC[%d][3] = {\n",
+            2 * HALF_FULL);
+    emit_rows(out, &full_rc[0][0], 2 * HALF_FULL, 3);
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "/* Partial-round constants (state[0] only) */\n");
+    fprintf(out, "static const _Alignas(CACHE_LINE_SIZE) field_t POSEIDON_PARTIAL_RC[%d] = {\n",
+            PARTIAL);
+    for (int i = 0; i < PARTIAL; i++) {
+        emit_field(out, &partial_rc[i], "    ", i + 1 < PARTIAL ? "," : "");
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "/* Sparse matrices for partial rounds 0..%d */\n", PARTIAL - 2);
+    fprintf(out, "static const _Alignas(CACHE_LINE_SIZE) poseidon_sparse_t POSEIDON_SPARSE[%d] = {\n",
+            PARTIAL - 1);
+    for (int i = 0; i < PARTIAL - 1; i++) {
+        fprintf(out, "    {\n        .w = {\n");
+        for (int j = 0; j < 3; j++) {
+            emit_field(out, &sparse_w[i][j], "            ", j < 2 ? "," : "");
+        }
+        fprintf(out, "        },\n        .v = {\n");
+        for (int j = 0; j < 2; j++) {
+            emit_field(out, &sparse_v[i][j], "            ", j < 1 ? "," : "");
+        }
+        fprintf(out, "        }\n    }%s\n", i + 1 < PARTIAL - 1 ? "," : "");
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "/* Dense matrix of the last partial round */\n");
+    fprintf(out, "static const _Alignas(CACHE_LINE_SIZE) field_t POSEIDON_MDS_LAST[3][3] = {\n");
+    emit_rows(out, &mds_last[0][0], 3, 3);
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "#endif /* POSEIDON_TABLES_H */\n");
+    if (out != stdout) fclose(out);
+
+    if (argc > 2) {
+        FILE *out52 = fopen(argv[2], "w");
+        if (!out52) {
+            perror(argv[2]);
+            return 1;
+        }
+        write_r52_tables(out52);
+        fclose(out52);
+    }
+    return 0;
+}